@@ -0,0 +1,139 @@
+﻿# New-XrExtensionFunctions.ps1
+# Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+# Licensed under the MIT licence. See LICENCE file for details.
+
+<#
+.SYNOPSIS
+Creates xrtl::xr_extension_function_traits from the Khronos Group's XML
+specification.
+
+.PARAMETER Path
+The Path parameter specifies the location of the XML specification.
+
+.PARAMETER Extension
+The Extension parameter specifies the extensions for which the functions are
+to be emitted. Wildcards are supported, so '*' emits the functions of all
+extensions.
+
+.PARAMETER HideAll
+The HideAll parameter specifies a list of extensions for which all functions
+are to be excluded.
+
+.OUTPUTS
+The script returns the xrtl::xr_extension_function enumeration and the
+declaration of the xrtl::xr_extension_function_traits specialisations for all
+commands of the selected extensions in the XML specification.
+
+.EXAMPLE
+.\New-XrExtensionFunctions.ps1 > .\xrtl\include\xrtl\xr_extension_functions.inl
+#>
+
+[CmdletBinding()]
+param(
+    [string] $Path = 'https://raw.githubusercontent.com/KhronosGroup/OpenXR-Docs/refs/heads/main/specification/registry/xr.xml',
+    [string[]] $Extension = @(
+        'XR_EXT_performance_settings',
+        'XR_EXT_thermal_query',
+        'XR_EXT_debug_utils',
+        'XR_KHR_opengl_enable',
+        'XR_KHR_D3D11_enable',
+        'XR_KHR_D3D12_enable',
+        'XR_KHR_visibility_mask',
+        'XR_KHR_win32_convert_performance_counter_time',
+        'XR_KHR_convert_timespec_time',
+        'XR_EXT_hand_tracking',
+        'XR_KHR_vulkan_enable2',
+        'XR_FB_display_refresh_rate'),
+    [string[]] $HideAll = @('XR_MSFT_spatial_graph_bridge')
+    )
+
+if ($Path -imatch 'https?://') {
+    [xml] $specification = (Invoke-WebRequest -Uri $Path).Content
+} else {
+    [xml] $specification = Get-Content $Path
+}
+
+$invocation = (Get-Variable MyInvocation -Scope Script).Value
+
+# Collect the commands of all selected extensions in the order of the
+# specification. The guard of each command is the name of its extension, which
+# is only defined by openxr.h or openxr_platform.h if the PFN_ types of the
+# extension are available, too.
+$commands = [System.Collections.ArrayList]::new()
+$seen = @{ }
+
+$specification.SelectNodes('//extensions/extension') | ForEach-Object {
+    $name = $_.name
+
+    if ($_.supported -eq 'disabled') {
+        return
+    }
+
+    if ($name -in $HideAll) {
+        return
+    }
+
+    $selected = $Extension | Where-Object { $name -like $_ }
+    if (-not $selected) {
+        return
+    }
+
+    $_.SelectNodes('require/command') | ForEach-Object {
+        if (-not $seen.ContainsKey($_.name)) {
+            $seen[$_.name] = $true
+            [void] $commands.Add([PSCustomObject] @{
+                Name = $_.name
+                Guard = $name
+            })
+        }
+    }
+}
+
+@"
+/******************************************************************************\
+ THIS FILE WAS GENERATED BY $($invocation.MyCommand.Name) ON $(Get-Date)
+\******************************************************************************/
+
+/// <summary>
+/// Identifies the extension functions that can be resolved via
+/// <see cref="extension_functions" />.
+/// </summary>
+enum class xr_extension_function : std::uint32_t {
+"@
+
+for ($i = 0; $i -lt $commands.Count; ++$i) {
+    "    $($commands[$i].Name) = $i,"
+}
+
+@"
+};
+
+
+/// <summary>
+/// The number of extension functions in <see cref="xr_extension_function" />.
+/// </summary>
+constexpr std::size_t xr_extension_function_count = $($commands.Count);
+
+"@
+
+$commands | ForEach-Object {
+    $name = $_.Name
+    $guard = $_.Guard
+
+    @"
+
+#if defined($guard)
+/// <summary>
+/// Specialisation for <see cref="$name" />.
+/// </summary>
+template<>
+struct xr_extension_function_traits<xr_extension_function::$name> {
+    typedef PFN_$name type;
+    static constexpr const char *name(void) noexcept {
+        return "$name";
+    }
+};
+#endif /* defined($guard) */
+
+"@
+}
@@ -0,0 +1,165 @@
+﻿# New-XrResultNames.ps1
+# Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+# Licensed under the MIT licence. See LICENCE file for details.
+
+<#
+.SYNOPSIS
+Creates xrtl::xr_result_name from the Khronos Group's XML specification.
+
+.PARAMETER Path
+The Path parameter specifies the location of the XML specification.
+
+.PARAMETER Extension
+The Extension parameter specifies the extensions for which the result codes
+are to be emitted in addition to the ones of the core specification. Wildcards
+are supported, so '*' emits the result codes of all extensions.
+
+.PARAMETER HideAll
+The HideAll parameter specifies a list of extensions for which all result
+codes are to be excluded.
+
+.OUTPUTS
+The script returns the definition of xrtl::xr_result_name, which maps all
+XrResult values in the XML specification to their names.
+
+.EXAMPLE
+.\New-XrResultNames.ps1 > .\xrtl\include\xrtl\xr_result_names.inl
+#>
+
+[CmdletBinding()]
+param(
+    [string] $Path = 'https://raw.githubusercontent.com/KhronosGroup/OpenXR-Docs/refs/heads/main/specification/registry/xr.xml',
+    [string[]] $Extension = @(
+        'XR_KHR_android_thread_settings',
+        'XR_MSFT_spatial_anchor',
+        'XR_MSFT_secondary_view_configuration',
+        'XR_MSFT_controller_model',
+        'XR_MSFT_composition_layer_reprojection',
+        'XR_MSFT_scene_understanding',
+        'XR_FB_display_refresh_rate',
+        'XR_FB_color_space',
+        'XR_FB_spatial_entity',
+        'XR_FB_passthrough',
+        'XR_FB_render_model',
+        'XR_VARJO_marker_tracking',
+        'XR_MSFT_spatial_anchor_persistence',
+        'XR_EXT_plane_detection',
+        'XR_EXT_future'),
+    [string[]] $HideAll = @('XR_MSFT_spatial_graph_bridge')
+    )
+
+if ($Path -imatch 'https?://') {
+    [xml] $specification = (Invoke-WebRequest -Uri $Path).Content
+} else {
+    [xml] $specification = Get-Content $Path
+}
+
+$invocation = (Get-Variable MyInvocation -Scope Script).Value
+
+# Collect the result codes in the order of the specification. Aliases are
+# skipped, because they would yield duplicate case labels. The guard of core
+# codes is empty, the one of codes added by a feature level is the name of the
+# feature and the one of extension codes is the protect attribute or the name
+# of the extension like for the type traits.
+$results = [System.Collections.ArrayList]::new()
+$seen = @{ }
+
+function Add-Result([string] $Name, [string] $Guard) {
+    if (-not $seen.ContainsKey($Name)) {
+        $seen[$Name] = $true
+        [void] $results.Add([PSCustomObject] @{
+            Name = $Name
+            Guard = $Guard
+        })
+    }
+}
+
+$specification.SelectNodes('//enums[@name="XrResult"]/enum') | ForEach-Object {
+    if (-not $_.alias) {
+        Add-Result $_.name ''
+    }
+}
+
+$specification.SelectNodes('//feature') | ForEach-Object {
+    $guard = $_.name
+
+    if ($_.name -in $HideAll) {
+        $guard = 'false'
+    }
+
+    $_.SelectNodes('require/enum[@extends="XrResult"]') | ForEach-Object {
+        if (-not $_.alias) {
+            Add-Result $_.name $guard
+        }
+    }
+}
+
+$specification.SelectNodes('//extensions/extension') | ForEach-Object {
+    $name = $_.name
+
+    if ($_.supported -eq 'disabled') {
+        return
+    }
+
+    if ($name -in $HideAll) {
+        return
+    }
+
+    $selected = $Extension | Where-Object { $name -like $_ }
+    if (-not $selected) {
+        return
+    }
+
+    $guard = $_.protect
+    if (-not $guard) {
+        $guard = $name
+    }
+
+    $_.SelectNodes('require/enum[@extends="XrResult"]') | ForEach-Object {
+        if (-not $_.alias) {
+            Add-Result $_.name $guard
+        }
+    }
+}
+
+@"
+/******************************************************************************\
+ THIS FILE WAS GENERATED BY $($invocation.MyCommand.Name) ON $(Get-Date)
+\******************************************************************************/
+
+/// <summary>
+/// Answer the name of the given <see cref="XrResult" /> as it is defined in
+/// the OpenXR specification.
+/// </summary>
+/// <param name="result">The result code to get the name of.</param>
+/// <returns>The name of the result code, or <c>nullptr</c> if the result code
+/// is unknown.</returns>
+constexpr _Ret_maybenull_z_ const char *xr_result_name(
+        _In_ const XrResult result) noexcept {
+    switch (result) {
+"@
+
+$current = ''
+$results | ForEach-Object {
+    if ($_.Guard -ne $current) {
+        if ($current) {
+            "#endif /* defined($current) */"
+        }
+        if ($_.Guard) {
+            "#if defined($($_.Guard))"
+        }
+        $current = $_.Guard
+    }
+
+    "        case $($_.Name): return `"$($_.Name)`";"
+}
+
+if ($current) {
+    "#endif /* defined($current) */"
+}
+
+@"
+        default: return nullptr;
+    }
+}
+"@
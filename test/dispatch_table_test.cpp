@@ -0,0 +1,60 @@
+﻿// <copyright file="dispatch_table_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/dispatch_table.h>
+#include <xrtl/path.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(dispatch_table_test) {
+
+public:
+
+    TEST_METHOD(test_dft_ctor) {
+        xrtl::dispatch_table t;
+        Assert::IsFalse(t, L"Not valid", LINE_INFO());
+        Assert::IsTrue(t.empty(), L"Empty", LINE_INFO());
+        Assert::IsTrue(t.xrStringToPath == nullptr, L"No function", LINE_INFO());
+    }
+
+    TEST_METHOD(test_instance_ctor) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::dispatch_table t(instance);
+            Assert::IsTrue(t, L"Valid", LINE_INFO());
+            Assert::IsTrue(instance.get() == t.instance(), L"Instance", LINE_INFO());
+            Assert::IsTrue(t.xrStringToPath != nullptr, L"xrStringToPath", LINE_INFO());
+            Assert::IsTrue(t.xrPathToString != nullptr, L"xrPathToString", LINE_INFO());
+            Assert::IsTrue(t.resolve<PFN_xrVoidFunction>("xrNonExistingFunction") == nullptr, L"Missing function", LINE_INFO());
+
+            const auto expected = "/interaction_profiles/ext/eye_gaze_interaction";
+            xrtl::path p(t, expected);
+            Assert::IsTrue(xrtl::path::parse(instance, expected) == p.get(), L"Same as loader", LINE_INFO());
+            Assert::AreEqual(expected, p.to_string(t).c_str(), L"String representation", LINE_INFO());
+
+            xrtl::xr_category_instance(t);
+            Assert::AreNotEqual(std::string("1"), xrtl::xr_category().message(XR_TIMEOUT_EXPIRED), L"message via table", LINE_INFO());
+            xrtl::xr_category_instance(XR_NULL_HANDLE);
+        }
+    }
+};
+
+}
@@ -0,0 +1,92 @@
+﻿// <copyright file="error_policy_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/error_policy.h>
+#include <xrtl/glm.h>
+#include <xrtl/matrix.h>
+#include <xrtl/path.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(error_policy_test) {
+
+public:
+
+    TEST_METHOD(test_default_policy) {
+        Assert::IsTrue(std::is_same<xrtl::default_error_policy, xrtl::throw_error_policy>::value, L"Throw by default", LINE_INFO());
+        Assert::IsFalse(xrtl::throw_error_policy::continues, L"Throw does not continue", LINE_INFO());
+        Assert::IsTrue(xrtl::return_error_policy::continues, L"Return continues", LINE_INFO());
+        Assert::IsTrue(xrtl::log_error_policy::continues, L"Log continues", LINE_INFO());
+        Assert::IsFalse(xrtl::abort_error_policy::continues, L"Abort does not continue", LINE_INFO());
+    }
+
+    TEST_METHOD(test_path) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            const auto expected = xrtl::path::parse(instance, "/user/hand/left");
+
+            auto r = xrtl::path::parse<xrtl::return_error_policy>(instance, "/user/hand/left");
+            Assert::IsTrue(r.has_value(), L"Valid path returned", LINE_INFO());
+            Assert::IsTrue(expected == *r, L"Same as throwing", LINE_INFO());
+
+            r = xrtl::path::parse<xrtl::return_error_policy>(instance, "no/path");
+            Assert::IsTrue(r.result() == XR_ERROR_PATH_FORMAT_INVALID, L"Error code returned", LINE_INFO());
+
+            auto l = xrtl::path::parse<xrtl::log_error_policy>(instance, "no/path");
+            Assert::IsTrue(l == XR_NULL_PATH, L"Null path logged", LINE_INFO());
+
+            Assert::ExpectException<std::system_error>([&]() { xrtl::path::parse<xrtl::throw_error_policy>(instance, "no/path"); }, L"Throws", LINE_INFO());
+
+            xrtl::path p(xrtl::log_error_policy(), instance, "no/path");
+            Assert::IsFalse(p, L"Empty path on failure", LINE_INFO());
+
+            xrtl::path q(xrtl::log_error_policy(), instance, "/user/hand/left");
+            Assert::IsTrue(expected == q.get(), L"Valid path constructed", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_make_matrix) {
+        XrFovf fov;
+        fov.angleLeft = -0.5f;
+        fov.angleRight = 0.5f;
+        fov.angleUp = 0.5f;
+        fov.angleDown = -0.5f;
+
+        XrFovf invalid = fov;
+        invalid.angleRight = invalid.angleLeft;
+
+        const auto expected = xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, 0.1f, 100.0f);
+
+        auto r = xrtl::make_matrix<xrtl::return_error_policy>(glm::frustumRH_ZO<float>, fov, 0.1f, 100.0f);
+        Assert::IsTrue(r.has_value(), L"Valid matrix returned", LINE_INFO());
+        Assert::IsTrue(expected == *r, L"Same as throwing", LINE_INFO());
+
+        r = xrtl::make_matrix<xrtl::return_error_policy>(glm::frustumRH_ZO<float>, invalid, 0.1f, 100.0f);
+        Assert::IsTrue(r.result() == XR_ERROR_VALIDATION_FAILURE, L"Validation failure returned", LINE_INFO());
+
+        // Must not throw.
+        xrtl::make_matrix<xrtl::log_error_policy>(glm::frustumRH_ZO<float>, invalid, 0.1f, 100.0f);
+
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::make_matrix(glm::frustumRH_ZO<float>, invalid, 0.1f, 100.0f); }, L"Throws", LINE_INFO());
+    }
+};
+
+}
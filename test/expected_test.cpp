@@ -0,0 +1,133 @@
+﻿// <copyright file="expected_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/expected.h>
+#include <xrtl/path.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+static xrtl::expected<int> make_value(const XrResult result) {
+    if (XR_FAILED(result)) {
+        return result;
+    } else {
+        return xrtl::expected<int>(42, result);
+    }
+}
+
+static XrResult try_result(const XrResult result, int& counter) {
+    XRTL_TRY(result);
+    ++counter;
+    return XR_SUCCESS;
+}
+
+static xrtl::expected<int> try_assign(const XrResult result) {
+    XRTL_TRY_ASSIGN(auto value, make_value(result));
+    return value + 1;
+}
+
+static xrtl::expected<int> try_assign_twice(const XrResult r1, const XrResult r2) {
+    // Both uses on the same line must not redeclare the temporary.
+    XRTL_TRY_ASSIGN(auto v1, make_value(r1)); XRTL_TRY_ASSIGN(auto v2, make_value(r2));
+    return v1 + v2;
+}
+
+
+TEST_CLASS(expected_test) {
+
+public:
+
+    TEST_METHOD(test_value) {
+        xrtl::expected<int> e(42);
+        Assert::IsTrue(e.has_value(), L"Has value", LINE_INFO());
+        Assert::IsTrue(static_cast<bool>(e), L"Has value", LINE_INFO());
+        Assert::IsTrue(e.result() == XR_SUCCESS, L"Result", LINE_INFO());
+        Assert::AreEqual(42, e.value(), L"Value", LINE_INFO());
+        Assert::AreEqual(42, *e, L"Dereference", LINE_INFO());
+        Assert::AreEqual(42, e.value_or(0), L"Value or", LINE_INFO());
+    }
+
+    TEST_METHOD(test_success_code) {
+        xrtl::expected<int> e(42, XR_SESSION_NOT_FOCUSED);
+        Assert::IsTrue(e.has_value(), L"Has value", LINE_INFO());
+        Assert::IsTrue(e.result() == XR_SESSION_NOT_FOCUSED, L"Success code preserved", LINE_INFO());
+
+        xrtl::expected<void> v(XR_FRAME_DISCARDED);
+        Assert::IsTrue(v.has_value(), L"Success", LINE_INFO());
+        Assert::IsTrue(v.result() == XR_FRAME_DISCARDED, L"Success code preserved", LINE_INFO());
+    }
+
+    TEST_METHOD(test_failure) {
+        xrtl::expected<int> e(XR_ERROR_SESSION_NOT_RUNNING);
+        Assert::IsFalse(e.has_value(), L"No value", LINE_INFO());
+        Assert::IsFalse(static_cast<bool>(e), L"No value", LINE_INFO());
+        Assert::IsTrue(e.result() == XR_ERROR_SESSION_NOT_RUNNING, L"Result", LINE_INFO());
+        Assert::AreEqual(7, e.value_or(7), L"Value or", LINE_INFO());
+        Assert::ExpectException<std::system_error>([&e](void) { e.value(); }, L"Value throws", LINE_INFO());
+
+        xrtl::expected<void> v(XR_ERROR_SESSION_LOST);
+        Assert::IsFalse(v.has_value(), L"Failure", LINE_INFO());
+        Assert::ExpectException<std::system_error>([&v](void) { v.value(); }, L"Value throws", LINE_INFO());
+    }
+
+    TEST_METHOD(test_try) {
+        int counter = 0;
+        Assert::IsTrue(try_result(XR_SESSION_LOSS_PENDING, counter) == XR_SUCCESS, L"Success codes pass", LINE_INFO());
+        Assert::AreEqual(1, counter, L"Continued", LINE_INFO());
+        Assert::IsTrue(try_result(XR_ERROR_SESSION_NOT_RUNNING, counter) == XR_ERROR_SESSION_NOT_RUNNING, L"Failure propagated", LINE_INFO());
+        Assert::AreEqual(1, counter, L"Returned early", LINE_INFO());
+    }
+
+    TEST_METHOD(test_try_assign) {
+        auto e = try_assign(XR_SUCCESS);
+        Assert::AreEqual(43, e.value(), L"Assigned", LINE_INFO());
+
+        e = try_assign(XR_ERROR_VALIDATION_FAILURE);
+        Assert::IsTrue(e.result() == XR_ERROR_VALIDATION_FAILURE, L"Failure propagated", LINE_INFO());
+
+        e = try_assign_twice(XR_SUCCESS, XR_SUCCESS);
+        Assert::AreEqual(84, e.value(), L"Assigned twice on one line", LINE_INFO());
+
+        e = try_assign_twice(XR_SUCCESS, XR_ERROR_HANDLE_INVALID);
+        Assert::IsTrue(e.result() == XR_ERROR_HANDLE_INVALID, L"Second failure propagated", LINE_INFO());
+    }
+
+    TEST_METHOD(test_try_parse) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            auto p = xrtl::path::try_parse(instance, "/user/hand/left");
+            Assert::IsTrue(p.has_value(), L"Valid path", LINE_INFO());
+            Assert::IsTrue(xrtl::path::parse(instance, "/user/hand/left") == *p, L"Same as throwing", LINE_INFO());
+
+            auto q = xrtl::path::try_parse(instance, "no/path");
+            Assert::IsFalse(q.has_value(), L"Invalid path", LINE_INFO());
+            Assert::IsTrue(q.result() == XR_ERROR_PATH_FORMAT_INVALID, L"Error code", LINE_INFO());
+
+            xrtl::path_cache cache(instance);
+            Assert::IsFalse(xrtl::path::try_parse(cache, "no/path").has_value(), L"Invalid path via cache", LINE_INFO());
+
+            char small[4];
+            auto s = xrtl::path(instance, "/user/hand/left").try_to_string(instance.get(), small, sizeof(small));
+            Assert::IsFalse(s.has_value(), L"Buffer too small", LINE_INFO());
+        }
+    }
+};
+
+}
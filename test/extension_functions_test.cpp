@@ -0,0 +1,68 @@
+﻿// <copyright file="extension_functions_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/debug_messenger.h>
+#include <xrtl/extension_functions.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(extension_functions_test) {
+
+public:
+
+    TEST_METHOD(test_dft_ctor) {
+        xrtl::extension_functions f;
+        Assert::IsTrue(f.instance() == XR_NULL_HANDLE, L"No instance", LINE_INFO());
+        Assert::IsTrue(f.get<xrtl::xr_extension_function::xrCreateDebugUtilsMessengerEXT>() == nullptr, L"Unavailable", LINE_INFO());
+    }
+
+    TEST_METHOD(test_traits) {
+        typedef xrtl::xr_extension_function_traits<xrtl::xr_extension_function::xrCreateDebugUtilsMessengerEXT> traits;
+        Assert::IsTrue(std::is_same<PFN_xrCreateDebugUtilsMessengerEXT, traits::type>::value, L"PFN type", LINE_INFO());
+        Assert::AreEqual("xrCreateDebugUtilsMessengerEXT", traits::name(), L"Name", LINE_INFO());
+    }
+
+    TEST_METHOD(test_resolve) {
+        const char *extensions[] = { XR_EXT_DEBUG_UTILS_EXTENSION_NAME };
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 1;
+        ci.enabledExtensionNames = extensions;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::extension_functions f(instance);
+            Assert::IsTrue(instance.get() == f.instance(), L"Instance", LINE_INFO());
+
+            auto create = f.get<xrtl::xr_extension_function::xrCreateDebugUtilsMessengerEXT>();
+            Assert::IsTrue(create != nullptr, L"Enabled extension", LINE_INFO());
+            Assert::IsTrue(create == f.get<xrtl::xr_extension_function::xrCreateDebugUtilsMessengerEXT>(), L"Cached", LINE_INFO());
+
+            auto mask = f.get<xrtl::xr_extension_function::xrGetVisibilityMaskKHR>();
+            Assert::IsTrue(mask == nullptr, L"Disabled extension", LINE_INFO());
+            Assert::IsTrue(mask == f.get<xrtl::xr_extension_function::xrGetVisibilityMaskKHR>(), L"Cached", LINE_INFO());
+
+            auto messenger = xrtl::make_debug_messenger<xrtl::debug_policy::required>(f,
+                [](XrDebugUtilsMessageSeverityFlagsEXT, XrDebugUtilsMessageTypeFlagsEXT, const XrDebugUtilsMessengerCallbackDataEXT *, void *) {
+                    return static_cast<XrBool32>(XR_FALSE);
+                });
+            Assert::IsTrue(messenger != nullptr, L"Messenger from cache", LINE_INFO());
+        }
+    }
+};
+
+}
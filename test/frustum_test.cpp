@@ -0,0 +1,139 @@
+﻿// <copyright file="frustum_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <cmath>
+#include <limits>
+
+#include <xrtl/frustum.h>
+#include <xrtl/glm.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(frustum_test) {
+
+public:
+
+    TEST_METHOD(test_single_view) {
+        XrView view = make_view(0.0f, 0.0f);
+        const auto frustum = xrtl::make_combined_frustum(&view, 1, 0.1f, 100.0f);
+
+        Assert::AreEqual(view.pose.position.x, frustum.pose.position.x, 1e-5f, L"Apex x", LINE_INFO());
+        Assert::AreEqual(view.pose.position.y, frustum.pose.position.y, 1e-5f, L"Apex y", LINE_INFO());
+        Assert::AreEqual(view.pose.position.z, frustum.pose.position.z, 1e-5f, L"Apex z", LINE_INFO());
+        Assert::AreEqual(view.fov.angleLeft, frustum.fov.angleLeft, 1e-5f, L"Left", LINE_INFO());
+        Assert::AreEqual(view.fov.angleRight, frustum.fov.angleRight, 1e-5f, L"Right", LINE_INFO());
+        Assert::AreEqual(view.fov.angleDown, frustum.fov.angleDown, 1e-5f, L"Down", LINE_INFO());
+        Assert::AreEqual(view.fov.angleUp, frustum.fov.angleUp, 1e-5f, L"Up", LINE_INFO());
+        Assert::AreEqual(0.1f, frustum.near_plane, 1e-5f, L"Near plane", LINE_INFO());
+        Assert::AreEqual(100.0f, frustum.far_plane, 1e-3f, L"Far plane", LINE_INFO());
+    }
+
+    TEST_METHOD(test_stereo) {
+        XrView views[2] = { make_view(-0.032f, 0.0f), make_view(0.032f, 0.0f) };
+        views[1].fov.angleLeft = -0.7f;
+        views[1].fov.angleRight = 0.9f;
+
+        const auto frustum = xrtl::make_combined_frustum(views, 0.1f, 100.0f);
+        assert_visible_inside(frustum, views, 2, 0.1f, 100.0f);
+
+        Assert::IsFalse(xrtl::contains(frustum, frustum.pose.position), L"Apex is before near plane", LINE_INFO());
+        Assert::IsFalse(xrtl::contains(frustum, point(views[0], 0.0f, 0.0f, 101.0f)), L"Beyond far plane", LINE_INFO());
+        Assert::IsFalse(xrtl::contains(frustum, point(views[0], -2.0f, 0.0f, 10.0f)), L"Left of frustum", LINE_INFO());
+        Assert::IsFalse(xrtl::contains(frustum, point(views[1], 0.0f, 2.0f, 10.0f)), L"Above frustum", LINE_INFO());
+
+        Assert::IsTrue(xrtl::intersects(frustum, point(views[0], -2.0f, 0.0f, 10.0f), 20.0f), L"Sphere overlaps", LINE_INFO());
+        Assert::IsFalse(xrtl::intersects(frustum, point(views[0], -2.0f, 0.0f, 10.0f), 1.0f), L"Sphere outside", LINE_INFO());
+    }
+
+    TEST_METHOD(test_canted_quad_view) {
+        // Canted displays with small inner views and an infinite far plane.
+        XrView views[4] = {
+            make_view(-0.032f, 0.17f),
+            make_view(0.032f, -0.17f),
+            make_view(-0.032f, 0.0f),
+            make_view(0.032f, 0.0f)
+        };
+        for (int i = 2; i < 4; ++i) {
+            views[i].fov.angleLeft = -0.3f;
+            views[i].fov.angleRight = 0.3f;
+            views[i].fov.angleUp = 0.3f;
+            views[i].fov.angleDown = -0.3f;
+        }
+
+        const auto far_plane = std::numeric_limits<float>::infinity();
+        const auto frustum = xrtl::make_combined_frustum(views, 0.05f, far_plane);
+        Assert::IsTrue(std::isinf(frustum.far_plane), L"Infinite far plane", LINE_INFO());
+        assert_visible_inside(frustum, views, 4, 0.05f, 1000.0f);
+    }
+
+    TEST_METHOD(test_invalid) {
+        XrView views[2] = { make_view(-0.032f, 0.0f), make_view(0.032f, 0.0f) };
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::make_combined_frustum(views, 0, 0.1f, 100.0f); }, L"No views", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::make_combined_frustum(views, 100.0f, 0.1f); }, L"Far plane before near plane", LINE_INFO());
+
+        views[1].pose.orientation.y = 1.0f;
+        views[1].pose.orientation.w = 0.0f;
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::make_combined_frustum(views, 0.1f, 100.0f); }, L"Opposite views", LINE_INFO());
+    }
+
+private:
+
+    static void assert_visible_inside(const xrtl::frustum& frustum,
+            const XrView *views,
+            const int cnt,
+            const float near_plane,
+            const float far_plane) {
+        // Sample the boundary and the interior of the frusta of all views
+        // including their corners.
+        constexpr int samples = 8;
+        for (int v = 0; v < cnt; ++v) {
+            const auto left = std::tan(views[v].fov.angleLeft);
+            const auto right = std::tan(views[v].fov.angleRight);
+            const auto bottom = std::tan(views[v].fov.angleDown);
+            const auto top = std::tan(views[v].fov.angleUp);
+
+            for (int x = 0; x <= samples; ++x) {
+                for (int y = 0; y <= samples; ++y) {
+                    for (int z = 0; z <= samples; ++z) {
+                        const auto tx = left + (right - left) * x / samples;
+                        const auto ty = bottom + (top - bottom) * y / samples;
+                        const auto d = near_plane + (far_plane - near_plane) * z / samples;
+                        Assert::IsTrue(xrtl::contains(frustum, point(views[v], tx, ty, d)), L"Visible point is inside", LINE_INFO());
+                    }
+                }
+            }
+        }
+    }
+
+    static XrView make_view(const float x, const float yaw) {
+        XrView retval { XR_TYPE_VIEW };
+        retval.pose.orientation.x = 0.0f;
+        retval.pose.orientation.y = std::sin(0.5f * yaw);
+        retval.pose.orientation.z = 0.0f;
+        retval.pose.orientation.w = std::cos(0.5f * yaw);
+        retval.pose.position.x = x;
+        retval.pose.position.y = 1.7f;
+        retval.pose.position.z = -2.0f;
+        retval.fov.angleLeft = -0.9f;
+        retval.fov.angleRight = 0.7f;
+        retval.fov.angleUp = 0.8f;
+        retval.fov.angleDown = -0.85f;
+        return retval;
+    }
+
+    static XrVector3f point(const XrView& view, const float tx, const float ty, const float distance) {
+        const auto p = xrtl::to_glm(view.pose) * glm::vec4(tx * distance, ty * distance, -distance, 1.0f);
+        return XrVector3f { p.x, p.y, p.z };
+    }
+};
+
+}
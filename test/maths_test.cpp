@@ -7,15 +7,30 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 
+#include <xrtl/eigen.h>
 #include <xrtl/glm.h>
 #include <xrtl/matrix.h>
+#include <xrtl/simd.h>
 #include <xrtl/xmath.h>
 
+#include "test_helpers.h"
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 
 namespace xrtltest {
 
+// GLM 1.0 stores the real part of quaternions first unless configured
+// otherwise, in which case xrtl::as_glm must not compile for quaternions.
+template<class TQuaternion>
+static void check_glm_quaternion_view(const TQuaternion *orientations) {
+    if constexpr (xrtl::detail::same_component_order<glm::quat, TQuaternion>::value) {
+        const glm::quat *q = xrtl::as_glm(orientations);
+        Assert::AreEqual(orientations[0].x, q[0].x, L"x", LINE_INFO());
+        Assert::AreEqual(orientations[0].w, q[0].w, L"w", LINE_INFO());
+    }
+}
+
 TEST_CLASS(maths_test) {
 
 public:
@@ -153,6 +168,142 @@ public:
         Assert::AreEqual(expected.w, xr.w, L"w", LINE_INFO());
     }
 
+    TEST_METHOD(test_glm_views) {
+        XrVector3f positions[] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+
+        glm::vec3 *gl = xrtl::as_glm(positions);
+        Assert::IsTrue(static_cast<void *>(gl) == static_cast<void *>(positions), L"No copy", LINE_INFO());
+        Assert::AreEqual(positions[1].y, gl[1].y, L"y", LINE_INFO());
+
+        gl[0].z = 42.0f;
+        Assert::AreEqual(42.0f, positions[0].z, L"Modification visible", LINE_INFO());
+
+        const XrVector3f *xr = xrtl::as_openxr(static_cast<const glm::vec3 *>(gl));
+        Assert::IsTrue(xr == positions, L"Round trip", LINE_INFO());
+
+        Assert::AreEqual(offsetof(glm::quat, w) == offsetof(XrQuaternionf, w),
+            xrtl::detail::same_component_order<glm::quat, XrQuaternionf>::value,
+            L"Quaternion layout detected", LINE_INFO());
+        const XrQuaternionf orientations[] = { { 1.0f, 2.0f, 3.0f, 4.0f } };
+        check_glm_quaternion_view(orientations);
+
+        const XrExtent2Df extents[] = { { 1.0f, 2.0f } };
+        const glm::vec2 *e = xrtl::as_glm(extents);
+        Assert::AreEqual(extents[0].width, e[0].x, L"Width", LINE_INFO());
+        Assert::AreEqual(extents[0].height, e[0].y, L"Height", LINE_INFO());
+    }
+
+    TEST_METHOD(test_xmath_views) {
+        XrVector3f positions[] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+
+        DirectX::XMFLOAT3 *xm = xrtl::as_xmfloat(positions);
+        Assert::AreEqual(positions[1].z, xm[1].z, L"z", LINE_INFO());
+
+        xm[0].x = 42.0f;
+        Assert::AreEqual(42.0f, positions[0].x, L"Modification visible", LINE_INFO());
+
+        XrVector3f *xr = xrtl::as_openxr(xm);
+        Assert::IsTrue(xr == positions, L"Round trip", LINE_INFO());
+
+        const XrQuaternionf orientations[] = { { 1.0f, 2.0f, 3.0f, 4.0f } };
+        const DirectX::XMFLOAT4 *q = xrtl::as_xmfloat(orientations);
+        Assert::AreEqual(orientations[0].y, q[0].y, L"y", LINE_INFO());
+        Assert::AreEqual(orientations[0].w, q[0].w, L"w", LINE_INFO());
+    }
+
+#if defined(__cpp_lib_span)
+    TEST_METHOD(test_glm_span_views) {
+        XrVector3f positions[] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+
+        auto gl = xrtl::as_glm(std::span(positions));
+        Assert::AreEqual(std::size_t(2), gl.size(), L"Size", LINE_INFO());
+        Assert::IsTrue(static_cast<void *>(gl.data()) == static_cast<void *>(positions), L"No copy", LINE_INFO());
+        Assert::AreEqual(positions[1].y, gl[1].y, L"y", LINE_INFO());
+
+        const auto xr = xrtl::as_openxr(gl);
+        Assert::IsTrue(xr.data() == positions, L"Round trip", LINE_INFO());
+    }
+
+    TEST_METHOD(test_xmath_span_views) {
+        const XrVector3f positions[] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+
+        const auto xm = xrtl::as_xmfloat(std::span(positions));
+        Assert::AreEqual(std::size_t(2), xm.size(), L"Size", LINE_INFO());
+        Assert::AreEqual(positions[1].z, xm[1].z, L"z", LINE_INFO());
+
+        const auto xr = xrtl::as_openxr(xm);
+        Assert::IsTrue(xr.data() == positions, L"Round trip", LINE_INFO());
+    }
+#endif /* defined(__cpp_lib_span) */
+
+    TEST_METHOD(test_eigen_map_vec3) {
+        XrVector3f expected = { 1.0f, 2.0f, 3.0f };
+
+        const auto ei = xrtl::as_eigen(static_cast<const XrVector3f&>(expected));
+        Assert::AreEqual(expected.x, ei.x(), L"x", LINE_INFO());
+        Assert::AreEqual(expected.y, ei.y(), L"y", LINE_INFO());
+        Assert::AreEqual(expected.z, ei.z(), L"z", LINE_INFO());
+
+        xrtl::as_eigen(expected) = Eigen::Vector3f(4.0f, 5.0f, 6.0f);
+        Assert::AreEqual(4.0f, expected.x, L"x", LINE_INFO());
+        Assert::AreEqual(5.0f, expected.y, L"y", LINE_INFO());
+        Assert::AreEqual(6.0f, expected.z, L"z", LINE_INFO());
+    }
+
+    TEST_METHOD(test_eigen_map_quat) {
+        const XrQuaternionf expected = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+        const auto ei = xrtl::as_eigen(expected);
+        Assert::AreEqual(expected.x, ei.x(), L"x", LINE_INFO());
+        Assert::AreEqual(expected.y, ei.y(), L"y", LINE_INFO());
+        Assert::AreEqual(expected.z, ei.z(), L"z", LINE_INFO());
+        Assert::AreEqual(expected.w, ei.w(), L"w", LINE_INFO());
+    }
+
+    TEST_METHOD(test_eigen_map_arrays) {
+        XrPosef poses[3];
+        for (int i = 0; i < 3; ++i) {
+            poses[i].orientation = { 0.0f, 0.0f, 0.0f, 1.0f };
+            poses[i].position = { 1.0f * i, 2.0f * i, 3.0f * i };
+        }
+
+        auto positions = xrtl::as_eigen_positions(poses, 3);
+        Assert::AreEqual(Eigen::Index(3), positions.cols(), L"Columns", LINE_INFO());
+        Assert::AreEqual(poses[2].position.y, positions(1, 2), L"y", LINE_INFO());
+        positions.col(1) = Eigen::Vector3f(7.0f, 8.0f, 9.0f);
+        Assert::AreEqual(8.0f, poses[1].position.y, L"Modification visible", LINE_INFO());
+        Assert::AreEqual(1.0f, poses[1].orientation.w, L"Orientation unchanged", LINE_INFO());
+
+        const auto orientations = xrtl::as_eigen_orientations(static_cast<const XrPosef *>(poses), 3);
+        Assert::AreEqual(poses[2].orientation.w, orientations(3, 2), L"w", LINE_INFO());
+
+        XrVector3f points[] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+        auto matrix = xrtl::as_eigen(points, 2);
+        Assert::IsTrue(matrix.data() == &points[0].x, L"No copy", LINE_INFO());
+        Assert::AreEqual(points[1].z, matrix(2, 1), L"z", LINE_INFO());
+    }
+
+    TEST_METHOD(test_eigen_pose) {
+        XrPosef pose;
+        pose.position = { 1.0f, 2.0f, 3.0f };
+        pose.orientation = { 0.0f, 0.5f * std::sqrt(2.0f), 0.0f, 0.5f * std::sqrt(2.0f) };
+
+        const auto expected = xrtl::to_glm(pose);
+        const auto actual = xrtl::to_eigen(pose);
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                Assert::AreEqual(expected[c][r], actual.matrix()(r, c), 1e-5f, L"Matrix element", LINE_INFO());
+            }
+        }
+
+        const auto xr = xrtl::from_eigen(actual);
+        Assert::AreEqual(pose.position.x, xr.position.x, 1e-5f, L"x", LINE_INFO());
+        Assert::AreEqual(pose.position.y, xr.position.y, 1e-5f, L"y", LINE_INFO());
+        Assert::AreEqual(pose.position.z, xr.position.z, 1e-5f, L"z", LINE_INFO());
+        Assert::AreEqual(pose.orientation.y, xr.orientation.y, 1e-5f, L"Orientation y", LINE_INFO());
+        Assert::AreEqual(pose.orientation.w, xr.orientation.w, 1e-5f, L"Orientation w", LINE_INFO());
+    }
+
     TEST_METHOD(test_projection) {
         constexpr float near_plane = 0.1f;
         constexpr float far_plane = 100.0f;
@@ -234,6 +385,341 @@ public:
         Assert::AreEqual(xm._43, gl[3][2], 1e-5f, L"4, 3", LINE_INFO());
         Assert::AreEqual(xm._44, gl[3][3], 1e-5f, L"4, 4", LINE_INFO());
     }
+
+    TEST_METHOD(test_projection_validation) {
+        XrFovf fov;
+        fov.angleLeft = -0.9f;
+        fov.angleRight = 0.8f;
+        fov.angleUp = 0.85f;
+        fov.angleDown = -0.95f;
+
+        auto builder = glm::frustumRH_ZO<float>;
+        const auto expected = xrtl::make_matrix(builder, fov, 0.1f, 100.0f);
+
+        const auto checked = xrtl::make_matrix<xrtl::checked_validation<>>(builder, fov, 0.1f, 100.0f);
+        Assert::IsTrue(expected == checked, L"Checked is default", LINE_INFO());
+
+        const auto asserted = xrtl::make_matrix<xrtl::assert_validation>(builder, fov, 0.1f, 100.0f);
+        Assert::IsTrue(expected == asserted, L"Asserted same as checked", LINE_INFO());
+
+        const auto unchecked = xrtl::make_matrix<xrtl::unchecked_validation>(builder, fov, 0.1f, 100.0f);
+        Assert::IsTrue(expected == unchecked, L"Unchecked same as checked", LINE_INFO());
+
+        Assert::IsTrue(noexcept(xrtl::make_matrix<xrtl::unchecked_validation>(builder, fov, 0.1f, 100.0f)), L"Unchecked is noexcept", LINE_INFO());
+        Assert::IsTrue(noexcept(xrtl::make_matrix<xrtl::assert_validation>(builder, fov, 0.1f, 100.0f)), L"Asserted is noexcept", LINE_INFO());
+        Assert::IsFalse(noexcept(xrtl::make_matrix(builder, fov, 0.1f, 100.0f)), L"Checked may throw", LINE_INFO());
+
+        XrFovf invalid { 0.0f, 0.0f, 0.5f, -0.5f };
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::make_matrix<xrtl::checked_validation<>>(builder, invalid, 0.1f, 100.0f); }, L"Checked throws", LINE_INFO());
+
+        const auto r = xrtl::make_matrix<xrtl::checked_validation<xrtl::return_error_policy>>(builder, invalid, 0.1f, 100.0f);
+        Assert::AreEqual(int(XR_ERROR_VALIDATION_FAILURE), int(r.result()), L"Checked with error policy", LINE_INFO());
+    }
+
+    TEST_METHOD(test_reverse_z_infinite) {
+        constexpr float near_plane = 0.1f;
+        constexpr float far_plane = 1000.0f;
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+
+        XrFovf fov;
+        fov.angleLeft = -0.9f;
+        fov.angleRight = 0.8f;
+        fov.angleUp = 0.85f;
+        fov.angleDown = -0.95f;
+
+        const auto standard = xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, near_plane, far_plane);
+        const auto distant = xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, near_plane, 1e7f);
+        const auto reverse = xrtl::make_matrix(xrtl::reverse_z_projection<glm::mat4>(), fov, near_plane, far_plane);
+        const auto infinite = xrtl::make_matrix(xrtl::infinite_projection<glm::mat4>(), fov, near_plane, infinity);
+        const auto infinite_reverse = xrtl::make_matrix(xrtl::infinite_reverse_z_projection<glm::mat4>(), fov, near_plane, infinity);
+
+        DirectX::XMFLOAT4X4 xm;
+        DirectX::XMStoreFloat4x4(&xm, xrtl::make_matrix(DirectX::XMMatrixPerspectiveOffCenterRH, fov, near_plane, far_plane));
+        DirectX::XMFLOAT4X4 xm_reverse;
+        DirectX::XMStoreFloat4x4(&xm_reverse, xrtl::make_matrix(xrtl::reverse_z_projection<DirectX::XMMATRIX>(), fov, near_plane, far_plane));
+
+        const auto project = [](const glm::mat4& m, const glm::vec3& p) {
+            const auto c = m * glm::vec4(p, 1.0f);
+            return glm::vec3(c) / c.w;
+        };
+
+        for (const auto z : { -near_plane, -0.5f, -1.0f, -10.0f, -100.0f, -999.0f }) {
+            const glm::vec3 p(0.3f * z, -0.2f * z, z);
+            const auto s = project(standard, p);
+            const auto d = project(distant, p);
+            const auto r = project(reverse, p);
+            const auto i = project(infinite, p);
+            const auto ir = project(infinite_reverse, p);
+
+            Assert::AreEqual(s.x, r.x, 1e-5f, L"Reverse x", LINE_INFO());
+            Assert::AreEqual(s.y, r.y, 1e-5f, L"Reverse y", LINE_INFO());
+            Assert::AreEqual(1.0f - s.z, r.z, 1e-6f, L"Reverse depth", LINE_INFO());
+            Assert::AreEqual(s.x, i.x, 1e-5f, L"Infinite x", LINE_INFO());
+            Assert::AreEqual(d.z, i.z, 1e-6f, L"Infinite depth", LINE_INFO());
+            Assert::AreEqual(s.y, ir.y, 1e-5f, L"Infinite reverse y", LINE_INFO());
+            Assert::AreEqual(1.0f - d.z, ir.z, 1e-6f, L"Infinite reverse depth", LINE_INFO());
+        }
+
+        Assert::AreEqual(1.0f, project(infinite_reverse, glm::vec3(0.0f, 0.0f, -near_plane)).z, 1e-6f, L"Near plane at one", LINE_INFO());
+
+        // DirectX Math uses the same memory layout.
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 4; ++r) {
+                Assert::AreEqual(xm.m[c][r], standard[c][r], 1e-5f, L"Same layout", LINE_INFO());
+                Assert::AreEqual(xm_reverse.m[c][r], reverse[c][r], 1e-5f, L"Same for DirectX", LINE_INFO());
+            }
+        }
+    }
+
+    TEST_METHOD(test_clip_space) {
+        constexpr float near_plane = 0.1f;
+        constexpr float far_plane = 100.0f;
+
+        XrFovf fov;
+        fov.angleLeft = -0.9f;
+        fov.angleRight = 0.8f;
+        fov.angleUp = 0.85f;
+        fov.angleDown = -0.95f;
+
+        const auto d3d = xrtl::make_matrix(xrtl::perspective_projection<glm::mat4>(), fov, near_plane, far_plane);
+        const auto gl = xrtl::make_matrix(xrtl::perspective_projection<glm::mat4, xrtl::opengl_clip_space>(), fov, near_plane, far_plane);
+        const auto vk = xrtl::make_matrix(xrtl::perspective_projection<glm::mat4, xrtl::vulkan_clip_space>(), fov, near_plane, far_plane);
+        const auto lh = xrtl::make_matrix(xrtl::perspective_projection<glm::mat4, xrtl::clip_space<xrtl::y_up, xrtl::zero_to_one, xrtl::left_handed>>(), fov, near_plane, far_plane);
+
+        // The conversions that would otherwise be applied to the result.
+        glm::mat4 flip_y(1.0f);
+        flip_y[1][1] = -1.0f;
+        glm::mat4 remap_depth(1.0f);
+        remap_depth[2][2] = 2.0f;
+        remap_depth[3][2] = -1.0f;
+        glm::mat4 flip_z(1.0f);
+        flip_z[2][2] = -1.0f;
+
+        const auto expected_d3d = xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, near_plane, far_plane);
+        const auto expected_gl = xrtl::make_matrix(glm::frustumRH_NO<float>, fov, near_plane, far_plane);
+        const auto expected_vk = flip_y * expected_d3d;
+        const auto expected_lh = expected_d3d * flip_z;
+        const auto expected_remap = remap_depth * expected_d3d;
+
+        DirectX::XMFLOAT4X4 xm_lh;
+        DirectX::XMStoreFloat4x4(&xm_lh, xrtl::make_matrix(DirectX::XMMatrixPerspectiveOffCenterLH, fov, near_plane, far_plane));
+        DirectX::XMFLOAT4X4 xm_vk;
+        DirectX::XMStoreFloat4x4(&xm_vk, xrtl::make_matrix(xrtl::perspective_projection<DirectX::XMMATRIX, xrtl::vulkan_clip_space>(), fov, near_plane, far_plane));
+
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 4; ++r) {
+                Assert::AreEqual(expected_d3d[c][r], d3d[c][r], 1e-5f, L"Direct3D", LINE_INFO());
+                Assert::AreEqual(expected_gl[c][r], gl[c][r], 1e-5f, L"OpenGL", LINE_INFO());
+                Assert::AreEqual(expected_remap[c][r], gl[c][r], 1e-5f, L"OpenGL as remapped Direct3D", LINE_INFO());
+                Assert::AreEqual(expected_vk[c][r], vk[c][r], 1e-5f, L"Vulkan", LINE_INFO());
+                Assert::AreEqual(expected_lh[c][r], lh[c][r], 1e-5f, L"Left-handed", LINE_INFO());
+                Assert::AreEqual(xm_lh.m[c][r], lh[c][r], 1e-5f, L"XMMatrixPerspectiveOffCenterLH", LINE_INFO());
+                Assert::AreEqual(expected_vk[c][r], xm_vk.m[c][r], 1e-5f, L"Vulkan with DirectX Math", LINE_INFO());
+            }
+        }
+    }
+
+    TEST_METHOD(test_inverse_projection) {
+        constexpr float near_plane = 0.1f;
+        constexpr float far_plane = 100.0f;
+
+        XrFovf fov;
+        fov.angleLeft = -0.9f;
+        fov.angleRight = 0.8f;
+        fov.angleUp = 0.85f;
+        fov.angleDown = -0.95f;
+
+        {
+            const auto projection = xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, near_plane, far_plane);
+            const auto actual = xrtl::make_matrix(xrtl::inverse_projection(glm::frustumRH_ZO<float>), fov, near_plane, far_plane);
+            const auto expected = glm::inverse(projection);
+            assert_equal(expected, actual, L"Inverse of glm::frustumRH_ZO", 1e-4f);
+            assert_equal(glm::mat4(1.0f), projection * actual, L"Identity", 1e-4f);
+        }
+
+        {
+            const auto projection = xrtl::make_matrix(xrtl::reverse_z_projection<glm::mat4, xrtl::vulkan_clip_space>(), fov, near_plane, far_plane);
+            const auto actual = xrtl::make_matrix(xrtl::inverse_projection<xrtl::reverse_z_projection<glm::mat4, xrtl::vulkan_clip_space>>(), fov, near_plane, far_plane);
+            assert_equal(glm::inverse(projection), actual, L"Inverse of reverse_z_projection", 1e-4f);
+        }
+
+        {
+            DirectX::XMFLOAT4X4 expected;
+            DirectX::XMStoreFloat4x4(&expected, DirectX::XMMatrixInverse(nullptr, xrtl::make_matrix(DirectX::XMMatrixPerspectiveOffCenterLH, fov, near_plane, far_plane)));
+            DirectX::XMFLOAT4X4 actual;
+            DirectX::XMStoreFloat4x4(&actual, xrtl::make_matrix(xrtl::inverse_projection(DirectX::XMMatrixPerspectiveOffCenterLH), fov, near_plane, far_plane));
+
+            for (int c = 0; c < 4; ++c) {
+                for (int r = 0; r < 4; ++r) {
+                    Assert::AreEqual(expected.m[c][r], actual.m[c][r], 1e-4f, L"Inverse of XMMatrixPerspectiveOffCenterLH", LINE_INFO());
+                }
+            }
+        }
+    }
+
+    TEST_METHOD(test_view_rays) {
+        // Odd sizes cover the vectorised part and the remainder.
+        constexpr int width = 7;
+        constexpr int height = 5;
+
+        XrFovf fov;
+        fov.angleLeft = -0.9f;
+        fov.angleRight = 0.8f;
+        fov.angleUp = 0.85f;
+        fov.angleDown = -0.95f;
+
+        XrVector3f rays[width * height];
+        xrtl::make_view_rays(fov, { width, height }, { { 0, 0 }, { width, height } }, rays);
+
+        // Unprojecting the pixel centres on the far plane must yield the same
+        // directions.
+        const auto inverse = glm::inverse(xrtl::make_matrix(glm::frustumRH_ZO<float>, fov, 0.1f, 100.0f));
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const auto ndc_x = 2.0f * (static_cast<float>(x) + 0.5f) / width - 1.0f;
+                const auto ndc_y = 1.0f - 2.0f * (static_cast<float>(y) + 0.5f) / height;
+                const auto p = inverse * glm::vec4(ndc_x, ndc_y, 1.0f, 1.0f);
+                const auto expected = glm::normalize(glm::vec3(p) / p.w);
+                const auto& actual = rays[y * width + x];
+                Assert::AreEqual(expected.x, actual.x, 1e-5f, L"x", LINE_INFO());
+                Assert::AreEqual(expected.y, actual.y, 1e-5f, L"y", LINE_INFO());
+                Assert::AreEqual(expected.z, actual.z, 1e-5f, L"z", LINE_INFO());
+            }
+        }
+
+        XrVector3f part[3 * 2];
+        xrtl::make_view_rays(fov, { width, height }, { { 4, 2 }, { 3, 2 } }, part);
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                const auto& expected = rays[(y + 2) * width + x + 4];
+                const auto& actual = part[y * 3 + x];
+                Assert::AreEqual(expected.x, actual.x, 1e-6f, L"Part x", LINE_INFO());
+                Assert::AreEqual(expected.y, actual.y, 1e-6f, L"Part y", LINE_INFO());
+                Assert::AreEqual(expected.z, actual.z, 1e-6f, L"Part z", LINE_INFO());
+            }
+        }
+    }
+
+    TEST_METHOD(test_simd_load_store) {
+        const XrVector2f v2 = { 1.0f, 2.0f };
+        XrVector2f a2;
+        xrtl::store_simd_vector(a2, xrtl::load_simd_vector(v2));
+        Assert::AreEqual(v2.x, a2.x, L"x", LINE_INFO());
+        Assert::AreEqual(v2.y, a2.y, L"y", LINE_INFO());
+
+        const XrVector3f v3 = { 1.0f, 2.0f, 3.0f };
+        XrVector3f a3;
+        xrtl::store_simd_vector(a3, xrtl::load_simd_vector(v3));
+        Assert::AreEqual(v3.x, a3.x, L"x", LINE_INFO());
+        Assert::AreEqual(v3.y, a3.y, L"y", LINE_INFO());
+        Assert::AreEqual(v3.z, a3.z, L"z", LINE_INFO());
+
+        const XrVector4f v4 = { 1.0f, 2.0f, 3.0f, 4.0f };
+        XrVector4f a4;
+        xrtl::store_simd_vector(a4, xrtl::load_simd_vector(v4));
+        Assert::AreEqual(v4.x, a4.x, L"x", LINE_INFO());
+        Assert::AreEqual(v4.y, a4.y, L"y", LINE_INFO());
+        Assert::AreEqual(v4.z, a4.z, L"z", LINE_INFO());
+        Assert::AreEqual(v4.w, a4.w, L"w", LINE_INFO());
+
+        const XrQuaternionf q = { 1.0f, 2.0f, 3.0f, 4.0f };
+        XrQuaternionf aq;
+        xrtl::store_simd_vector(aq, xrtl::load_simd_vector(q));
+        Assert::AreEqual(q.x, aq.x, L"x", LINE_INFO());
+        Assert::AreEqual(q.y, aq.y, L"y", LINE_INFO());
+        Assert::AreEqual(q.z, aq.z, L"z", LINE_INFO());
+        Assert::AreEqual(q.w, aq.w, L"w", LINE_INFO());
+    }
+
+    TEST_METHOD(test_simd_pose) {
+        XrPosef pose;
+        pose.position.x = 1.0f;
+        pose.position.y = 2.0f;
+        pose.position.z = 3.0f;
+        pose.orientation.x = 0.5f;
+        pose.orientation.y = 0.5f;
+        pose.orientation.z = -0.5f;
+        pose.orientation.w = 0.5f;
+
+        const auto gl = xrtl::to_glm(pose);
+
+        glm::mat4 simd;
+        xrtl::store_simd_matrix(glm::value_ptr(simd), xrtl::load_simd_matrix(pose));
+
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 4; ++r) {
+                Assert::AreEqual(gl[c][r], simd[c][r], 1e-5f, L"Same as glm", LINE_INFO());
+            }
+        }
+    }
+
+    TEST_METHOD(test_view_matrix) {
+        XrPosef pose;
+        pose.position.x = 1.0f;
+        pose.position.y = -2.0f;
+        pose.position.z = 3.0f;
+        pose.orientation.x = 0.1f;
+        pose.orientation.y = 0.7f;
+        pose.orientation.z = -0.1f;
+        pose.orientation.w = 0.7f;
+        const auto len = std::sqrt(0.1f * 0.1f + 0.7f * 0.7f + 0.1f * 0.1f + 0.7f * 0.7f);
+        pose.orientation.x /= len;
+        pose.orientation.y /= len;
+        pose.orientation.z /= len;
+        pose.orientation.w /= len;
+
+        const auto expected = glm::inverse(xrtl::to_glm(pose));
+        const auto gl = xrtl::to_view_matrix(pose);
+
+        DirectX::XMFLOAT4X4 xm;
+        DirectX::XMStoreFloat4x4(&xm, xrtl::load_xmview_matrix(pose));
+
+        glm::mat4 simd;
+        xrtl::store_simd_matrix(glm::value_ptr(simd), xrtl::load_simd_view_matrix(pose));
+
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 4; ++r) {
+                Assert::AreEqual(expected[c][r], gl[c][r], 1e-5f, L"Same as glm::inverse", LINE_INFO());
+                Assert::AreEqual(expected[c][r], xm.m[c][r], 1e-5f, L"Same as glm::inverse", LINE_INFO());
+                Assert::AreEqual(expected[c][r], simd[c][r], 1e-5f, L"Same as glm::inverse", LINE_INFO());
+            }
+        }
+    }
+
+    TEST_METHOD(test_to_matrices) {
+        // Seven poses cover the vectorised part and the remainder.
+        XrPosef poses[7];
+        for (int i = 0; i < 7; ++i) {
+            const auto angle = 0.3f * static_cast<float>(i);
+            poses[i].position.x = static_cast<float>(i);
+            poses[i].position.y = 2.0f * static_cast<float>(i);
+            poses[i].position.z = -1.0f;
+            poses[i].orientation.x = 0.0f;
+            poses[i].orientation.y = std::sin(angle);
+            poses[i].orientation.z = 0.0f;
+            poses[i].orientation.w = std::cos(angle);
+        }
+
+        glm::mat4 gl[7];
+        xrtl::to_matrices(poses, 7, gl);
+
+        DirectX::XMMATRIX xmm[7];
+        xrtl::to_matrices(poses, 7, xmm);
+
+        for (int i = 0; i < 7; ++i) {
+            const auto expected = xrtl::to_glm(poses[i]);
+            DirectX::XMFLOAT4X4 xm;
+            DirectX::XMStoreFloat4x4(&xm, xmm[i]);
+
+            for (glm::length_t c = 0; c < 4; ++c) {
+                for (glm::length_t r = 0; r < 4; ++r) {
+                    Assert::AreEqual(expected[c][r], gl[i][c][r], 1e-5f, L"Same as glm", LINE_INFO());
+                    Assert::AreEqual(expected[c][r], xm.m[c][r], 1e-5f, L"Same as DirectX", LINE_INFO());
+                }
+            }
+        }
+    }
+
 };
 
 }
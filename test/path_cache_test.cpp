@@ -0,0 +1,132 @@
+﻿// <copyright file="path_cache_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <thread>
+#include <vector>
+
+#include <xrtl/path.h>
+#include <xrtl/path_cache.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(path_cache_test) {
+
+public:
+
+    TEST_METHOD(test_parse) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::path_cache cache(instance);
+            Assert::IsTrue(instance.get() == cache.instance(), L"Instance", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0), cache.hits(), L"No hits", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0), cache.misses(), L"No misses", LINE_INFO());
+
+            const auto expected = "/user/hand/left/input/select/click";
+            xrtl::path p(cache, expected);
+            Assert::IsTrue(xrtl::path::parse(instance, expected) == p.get(), L"Same as loader", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0), cache.hits(), L"First parse missed", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.misses(), L"First parse missed", LINE_INFO());
+
+            xrtl::path q(cache, expected);
+            Assert::IsTrue(p.get() == q.get(), L"Same path", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.hits(), L"Second parse hit", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.misses(), L"Second parse hit", LINE_INFO());
+
+            Assert::AreEqual(std::string(expected), p.to_string(cache), L"Reverse lookup", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(2), cache.hits(), L"Reverse lookup hit", LINE_INFO());
+
+            cache.clear();
+            Assert::AreEqual(std::uint64_t(0), cache.hits(), L"Hits cleared", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0), cache.misses(), L"Misses cleared", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_to_string) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::dispatch_table table(instance);
+            xrtl::path_cache cache(table);
+
+            const auto expected = "/user/hand/right";
+            xrtl::path p(instance, expected);
+            Assert::AreEqual(std::string(expected), p.to_string(cache), L"Reverse lookup", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.misses(), L"Reverse lookup missed", LINE_INFO());
+
+            Assert::IsTrue(p.get() == cache.parse(expected), L"Interned by reverse lookup", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.hits(), L"Forward lookup hit", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_concurrent) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::path_cache cache(instance);
+            const char *paths[] = {
+                "/user/hand/left",
+                "/user/hand/right",
+                "/user/head",
+                "/user/gamepad"
+            };
+            const auto cnt_paths = sizeof(paths) / sizeof(*paths);
+            const auto cnt_threads = 4;
+            const auto cnt_iterations = 100;
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < cnt_threads; ++t) {
+                threads.emplace_back([&cache, &paths, cnt_paths]() {
+                    for (int i = 0; i < cnt_iterations; ++i) {
+                        cache.parse(paths[i % cnt_paths]);
+                    }
+                });
+            }
+
+            for (auto& t : threads) {
+                t.join();
+            }
+
+            Assert::AreEqual(std::uint64_t(cnt_threads * cnt_iterations), cache.hits() + cache.misses(), L"All lookups counted", LINE_INFO());
+
+            for (auto p : paths) {
+                Assert::IsTrue(xrtl::path::parse(instance, p) == cache.parse(p), L"Same as loader", LINE_INFO());
+            }
+        }
+    }
+};
+
+}
@@ -0,0 +1,71 @@
+﻿// <copyright file="path_literal_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/path.h>
+#include <xrtl/path_literal.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace xrtl::literals;
+
+
+namespace xrtltest {
+
+TEST_CLASS(path_literal_test) {
+
+public:
+
+    TEST_METHOD(test_compile_time) {
+        constexpr auto p = "/user/hand/left"_xrpath;
+        static_assert(p.length() == 15, "Length is computed at compile time.");
+        static_assert(p.hash() == xrtl::detail::fnv1a("/user/hand/left", 15), "Hash is computed at compile time.");
+        Assert::AreEqual("/user/hand/left", p.c_str(), L"String", LINE_INFO());
+        Assert::IsTrue(std::string_view("/user/hand/left") == p, L"View", LINE_INFO());
+        Assert::AreNotEqual(p.hash(), "/user/hand/right"_xrpath.hash(), L"Different hash", LINE_INFO());
+    }
+
+    TEST_METHOD(test_grammar) {
+        Assert::ExpectException<std::invalid_argument>([]() { "user/hand"_xrpath; }, L"No leading slash", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([]() { "/user/"_xrpath; }, L"Trailing slash", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([]() { "/user//hand"_xrpath; }, L"Adjacent slashes", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([]() { "/User/hand"_xrpath; }, L"Upper case", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([]() { "/user/../hand"_xrpath; }, L"Periods only", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([]() { "/"_xrpath; }, L"Root only", LINE_INFO());
+        "/interaction_profiles/khr/simple_controller"_xrpath;
+        "/user/hand/left/input/trigger.value-1"_xrpath;
+    }
+
+    TEST_METHOD(test_resolve) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            xrtl::path_cache cache(instance);
+
+            xrtl::path p(cache, "/user/hand/left"_xrpath);
+            Assert::IsTrue(xrtl::path::parse(instance, "/user/hand/left") == p.get(), L"Same as loader", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.misses(), L"First use missed", LINE_INFO());
+
+            xrtl::path q(cache, "/user/hand/left"_xrpath);
+            Assert::IsTrue(p.get() == q.get(), L"Same path", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0), cache.hits(), L"Resolved literals are not counted", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(1), cache.misses(), L"Second use hit", LINE_INFO());
+
+            Assert::IsTrue(p.get() == cache.parse("/user/hand/left"), L"Literal is in map", LINE_INFO());
+        }
+    }
+};
+
+}
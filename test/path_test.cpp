@@ -7,6 +7,8 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 
+#include <memory_resource>
+
 #include <xrtl/path.h>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -44,6 +46,116 @@ public:
         }
     }
 
+    TEST_METHOD(test_to_string_no_alloc) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            const auto expected = "/interaction_profiles/ext/eye_gaze_interaction";
+            xrtl::path p(instance, expected);
+
+            char buffer[XR_MAX_PATH_LENGTH];
+            const auto len = p.to_string(instance.get(), buffer, XR_MAX_PATH_LENGTH);
+            Assert::AreEqual(std::strlen(expected), len, L"Length", LINE_INFO());
+            Assert::AreEqual(expected, buffer, L"Buffer", LINE_INFO());
+
+            char small[4];
+            Assert::ExpectException<std::system_error>([&]() { p.to_string(instance.get(), small, sizeof(small)); }, L"Buffer too small", LINE_INFO());
+
+            // The upstream resource throws if the string does not fit into the
+            // arena, so this proves that there is no heap allocation.
+            char arena[2 * XR_MAX_PATH_LENGTH];
+            std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+            const auto pmr = p.to_string(instance.get(), &resource);
+            Assert::AreEqual(expected, pmr.c_str(), L"PMR string", LINE_INFO());
+
+            xrtl::path_cache cache(instance);
+            const auto view = p.to_string_view(cache);
+            Assert::IsTrue(std::string_view(expected) == view, L"View", LINE_INFO());
+            Assert::IsTrue(view.data() == p.to_string_view(cache).data(), L"View owned by cache", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_to_string_overloads) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            const std::string expected("/user/hand/left");
+            xrtl::dispatch_table table(instance);
+            xrtl::path_cache cache(instance);
+            xrtl::path p(instance, expected.c_str());
+
+            Assert::AreEqual(expected, p.to_string(instance.get()), L"XrInstance", LINE_INFO());
+            Assert::AreEqual(expected, p.to_string(instance), L"unique_instance", LINE_INFO());
+            Assert::AreEqual(expected, p.to_string(table), L"dispatch_table", LINE_INFO());
+            Assert::AreEqual(expected, p.to_string(cache), L"path_cache", LINE_INFO());
+            Assert::AreEqual(expected.size(), p.to_string(table).size(), L"No terminating null", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_parse_batch) {
+        XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
+        ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
+        ci.applicationInfo.applicationVersion = 1;
+        ::strncpy_s(ci.applicationInfo.engineName, "Test", XR_MAX_ENGINE_NAME_SIZE);
+        ci.applicationInfo.engineVersion = 1;
+        ci.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+        ci.enabledApiLayerCount = 0;
+        ci.enabledExtensionCount = 0;
+        xrtl::unique_instance instance;
+
+        if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
+            const char *paths[] = {
+                "/user/hand/left",
+                "/user/hand/right",
+                "/user/hand/left",
+                "/user/head",
+                "/user/hand/right",
+                "/user/hand/left/input/select/click"
+            };
+            const auto cnt = sizeof(paths) / sizeof(*paths);
+
+            for (std::size_t workers = 1; workers <= 4; ++workers) {
+                XrPath actual[cnt];
+                xrtl::path::parse(instance.get(), paths, cnt, actual, workers);
+
+                for (std::size_t i = 0; i < cnt; ++i) {
+                    Assert::IsTrue(xrtl::path::parse(instance, paths[i]) == actual[i], L"Same as single conversion", LINE_INFO());
+                }
+            }
+
+            {
+                xrtl::path_cache cache(instance);
+                XrPath actual[cnt];
+                xrtl::path::parse(cache, paths, cnt, actual, 2);
+                Assert::AreEqual(std::uint64_t(4), cache.misses(), L"Distinct strings converted once", LINE_INFO());
+                Assert::IsTrue(actual[0] == actual[2], L"Duplicates resolved", LINE_INFO());
+                Assert::IsTrue(actual[1] == actual[4], L"Duplicates resolved", LINE_INFO());
+            }
+
+            {
+                const char *invalid[] = { "/user/hand/left", "no/path" };
+                XrPath actual[2];
+                Assert::ExpectException<std::system_error>([&]() { xrtl::path::parse(instance.get(), invalid, 2, actual, 2); }, L"Invalid path", LINE_INFO());
+            }
+        }
+    }
+
 };
 
 }
@@ -8,11 +8,15 @@
 #define PCH_H
 #pragma once
 
+#define XRTL_WITH_EIGEN
 #define XRTL_WITH_GLM
 
 #include <DirectXMath.h>
 #include <Windows.h>
 
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 
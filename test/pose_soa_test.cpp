@@ -0,0 +1,130 @@
+﻿// <copyright file="pose_soa_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <cmath>
+
+#include <xrtl/glm.h>
+#include <xrtl/pose_soa.h>
+
+#include "test_helpers.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(pose_soa_test) {
+
+public:
+
+    TEST_METHOD(test_resize) {
+        xrtl::pose_soa poses;
+        Assert::IsTrue(poses.empty(), L"New container is empty", LINE_INFO());
+        Assert::AreEqual(std::size_t(0), poses.stride(), L"No stride", LINE_INFO());
+
+        poses.resize(3);
+        Assert::AreEqual(std::size_t(3), poses.size(), L"Size", LINE_INFO());
+        Assert::AreEqual(std::size_t(8), poses.stride(), L"Stride padded", LINE_INFO());
+        Assert::AreEqual(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(poses.qw()) % 32, L"Aligned", LINE_INFO());
+
+        XrPosef pose { { 0.0f, 1.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f } };
+        poses.set(1, pose);
+        poses.resize(11);
+        Assert::AreEqual(std::size_t(16), poses.stride(), L"Stride grown", LINE_INFO());
+        Assert::AreEqual(2.0f, poses.get(1).position.y, L"Pose preserved", LINE_INFO());
+        Assert::AreEqual(1.0f, poses.get(1).orientation.y, L"Pose preserved", LINE_INFO());
+
+        for (std::size_t i = 3; i < poses.stride(); ++i) {
+            Assert::AreEqual(1.0f, poses.qw()[i], L"New poses are identity", LINE_INFO());
+            Assert::AreEqual(0.0f, poses.px()[i], L"New poses are identity", LINE_INFO());
+        }
+
+        poses.clear();
+        Assert::IsTrue(poses.empty(), L"Cleared", LINE_INFO());
+    }
+
+    TEST_METHOD(test_space_location) {
+        // Seven poses cover the vectorised part and the remainder.
+        XrSpaceLocation locations[7];
+        for (int i = 0; i < 7; ++i) {
+            locations[i] = { XR_TYPE_SPACE_LOCATION };
+            locations[i].locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+            locations[i].pose = make_pose(i);
+        }
+
+        xrtl::pose_soa poses;
+        poses.assign(locations, 7);
+        Assert::AreEqual(std::size_t(7), poses.size(), L"Size", LINE_INFO());
+
+        XrSpaceLocation copies[7];
+        for (auto& c : copies) {
+            c = { XR_TYPE_SPACE_LOCATION };
+        }
+        poses.copy_to(copies, 7);
+
+        for (int i = 0; i < 7; ++i) {
+            Assert::AreEqual(int(XR_TYPE_SPACE_LOCATION), int(copies[i].type), L"Type unchanged", LINE_INFO());
+            Assert::AreEqual(XrSpaceLocationFlags(0), copies[i].locationFlags, L"Flags unchanged", LINE_INFO());
+            assert_equal(locations[i].pose, copies[i].pose);
+        }
+    }
+
+    TEST_METHOD(test_compose_invert) {
+        XrPosef lhs[7];
+        XrPosef rhs[7];
+        for (int i = 0; i < 7; ++i) {
+            lhs[i] = make_pose(i);
+            rhs[i] = make_pose(7 - i);
+        }
+
+        xrtl::pose_soa l(lhs, 7);
+        xrtl::pose_soa r(rhs, 7);
+        xrtl::pose_soa c;
+        xrtl::compose(l, r, c);
+
+        for (int i = 0; i < 7; ++i) {
+            const auto expected = xrtl::to_glm(lhs[i]) * xrtl::to_glm(rhs[i]);
+            assert_equal(expected, xrtl::to_glm(c.get(i)));
+        }
+
+        xrtl::compose(lhs[2], r, c);
+        for (int i = 0; i < 7; ++i) {
+            const auto expected = xrtl::to_glm(lhs[2]) * xrtl::to_glm(rhs[i]);
+            assert_equal(expected, xrtl::to_glm(c.get(i)));
+        }
+
+        // Composing a pose with its inverse yields the identity.
+        xrtl::invert(l, c);
+        xrtl::compose(l, c, c);
+        for (int i = 0; i < 7; ++i) {
+            assert_equal(glm::mat4(1.0f), xrtl::to_glm(c.get(i)));
+        }
+
+        xrtl::pose_soa s(3);
+        Assert::ExpectException<std::invalid_argument>([&]() { xrtl::compose(l, s, c); }, L"Size mismatch", LINE_INFO());
+    }
+
+    TEST_METHOD(test_to_matrices) {
+        XrPosef poses[7];
+        for (int i = 0; i < 7; ++i) {
+            poses[i] = make_pose(i);
+        }
+
+        xrtl::pose_soa soa(poses, 7);
+        glm::mat4 matrices[7];
+        xrtl::to_matrices(soa, glm::value_ptr(matrices[0]));
+
+        for (int i = 0; i < 7; ++i) {
+            assert_equal(xrtl::to_glm(poses[i]), matrices[i]);
+        }
+    }
+
+};
+
+}
@@ -0,0 +1,229 @@
+﻿// <copyright file="pose_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <xrtl/glm.h>
+#include <xrtl/pose.h>
+
+#include "test_helpers.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(pose_test) {
+
+public:
+
+    TEST_METHOD(test_compose_invert) {
+        for (int i = 0; i < 7; ++i) {
+            const auto lhs = make_pose(i);
+            const auto rhs = make_pose(7 - i);
+
+            const auto expected = xrtl::to_glm(lhs) * xrtl::to_glm(rhs);
+            assert_equal(expected, xrtl::to_glm(xrtl::compose(lhs, rhs)));
+
+            assert_equal(glm::inverse(xrtl::to_glm(lhs)), xrtl::to_glm(xrtl::invert(lhs)));
+            assert_equal(glm::mat4(1.0f), xrtl::to_glm(xrtl::compose(lhs, xrtl::invert(lhs))));
+
+            const auto q = xrtl::multiply(lhs.orientation, xrtl::invert(lhs.orientation));
+            Assert::AreEqual(1.0f, q.w, 1e-5f, L"Identity quaternion", LINE_INFO());
+        }
+    }
+
+    TEST_METHOD(test_relative_pose) {
+        for (int i = 0; i < 7; ++i) {
+            const auto base = make_pose(i);
+            const auto pose = make_pose(i + 3);
+            const auto relative = xrtl::relative_pose(base, pose);
+
+            const auto expected = glm::inverse(xrtl::to_glm(base)) * xrtl::to_glm(pose);
+            assert_equal(expected, xrtl::to_glm(relative));
+            assert_equal(xrtl::to_glm(pose), xrtl::to_glm(xrtl::compose(base, relative)));
+        }
+    }
+
+    TEST_METHOD(test_transform) {
+        const auto pose = make_pose(3);
+        const auto matrix = xrtl::to_glm(pose);
+
+        // Seven points cover an odd remainder for all batch sizes.
+        XrVector3f points[7];
+        for (int i = 0; i < 7; ++i) {
+            points[i].x = static_cast<float>(i);
+            points[i].y = -2.0f * static_cast<float>(i);
+            points[i].z = 0.5f;
+        }
+
+        XrVector3f transformed[7];
+        xrtl::transform_points(pose, points, 7, transformed);
+        XrVector3f directions[7];
+        xrtl::transform_directions(pose, points, 7, directions);
+
+        for (int i = 0; i < 7; ++i) {
+            const glm::vec3 p(points[i].x, points[i].y, points[i].z);
+            const auto point = glm::vec3(matrix * glm::vec4(p, 1.0f));
+            const auto direction = glm::vec3(matrix * glm::vec4(p, 0.0f));
+
+            assert_equal(point, xrtl::transform_point(pose, points[i]));
+            assert_equal(point, transformed[i]);
+            assert_equal(direction, xrtl::transform_direction(pose, points[i]));
+            assert_equal(direction, xrtl::rotate(pose.orientation, points[i]));
+            assert_equal(direction, directions[i]);
+        }
+
+        xrtl::transform_points(pose, points, 7, points);
+        for (int i = 0; i < 7; ++i) {
+            assert_equal(glm::vec3(transformed[i].x, transformed[i].y, transformed[i].z), points[i]);
+        }
+    }
+
+    TEST_METHOD(test_transform_batch) {
+        const auto pose = make_pose(5);
+        auto matrix = xrtl::load_simd_matrix(pose);
+        const auto hints = { xrtl::store_hint::cached, xrtl::store_hint::non_temporal };
+
+        // The offsets move the output relative to the alignment required for
+        // non-temporal stores and the size covers all block sizes.
+        std::vector<XrVector3f> points(45);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            points[i].x = 0.1f * static_cast<float>(i);
+            points[i].y = 2.0f - static_cast<float>(i);
+            points[i].z = -0.5f * static_cast<float>(i);
+        }
+
+        for (auto hint : hints) {
+            for (std::size_t offset = 0; offset < 8; ++offset) {
+                const auto cnt = points.size() - offset;
+                std::vector<XrVector3f> result(points.size());
+                xrtl::transform_points(matrix, points.data() + offset, cnt, result.data() + offset, hint);
+
+                auto in_place = points;
+                xrtl::transform_points(pose, in_place.data() + offset, cnt, in_place.data() + offset, hint);
+
+                for (std::size_t i = offset; i < points.size(); ++i) {
+                    const auto expected = xrtl::transform_point(pose, points[i]);
+                    const glm::vec3 e(expected.x, expected.y, expected.z);
+                    assert_equal(e, result[i]);
+                    assert_equal(e, in_place[i]);
+                }
+            }
+        }
+    }
+
+    TEST_METHOD(test_interpolate) {
+        const auto methods = { xrtl::interpolation::nlerp, xrtl::interpolation::slerp };
+
+        for (int i = 0; i < 7; ++i) {
+            const auto from = make_pose(i);
+            auto to = make_pose(i + 2);
+
+            // Negating the quaternion must not change the shorter arc.
+            if (i % 2 == 1) {
+                to.orientation = { -to.orientation.x, -to.orientation.y, -to.orientation.z, -to.orientation.w };
+            }
+
+            for (const auto t : { 0.0f, 0.25f, 0.5f, 1.0f }) {
+                const auto q = glm::slerp(xrtl::to_glm(from.orientation), xrtl::to_glm(to.orientation), t);
+                const auto p = glm::mix(xrtl::to_glm(from.position), xrtl::to_glm(to.position), t);
+                const auto expected = glm::translate(glm::mat4(1.0f), p) * glm::mat4_cast(q);
+
+                assert_equal(glm::mat4_cast(q), glm::mat4_cast(xrtl::to_glm(xrtl::slerp(from.orientation, to.orientation, t))));
+                assert_equal(expected, xrtl::to_glm(xrtl::interpolate(from, to, t)));
+
+                const auto nlerp = xrtl::nlerp(from.orientation, to.orientation, t);
+                Assert::AreEqual(1.0f, glm::length(xrtl::to_glm(nlerp)), 1e-5f, L"Unit quaternion", LINE_INFO());
+
+                // Both methods coincide at the end points and the centre.
+                if (t != 0.25f) {
+                    assert_equal(glm::mat4_cast(q), glm::mat4_cast(xrtl::to_glm(nlerp)));
+                }
+            }
+        }
+
+        // Seven poses cover a full block and a padded remainder.
+        XrPosef from[7], to[7];
+        for (int i = 0; i < 7; ++i) {
+            from[i] = make_pose(i);
+            to[i] = make_pose(2 * i);
+        }
+
+        for (auto method : methods) {
+            XrPosef result[7];
+            xrtl::interpolate(from, to, 7, 0.3f, result, method);
+
+            XrPosef in_place[7];
+            std::copy(from, from + 7, in_place);
+            xrtl::interpolate(in_place, to, 7, 0.3f, in_place, method);
+
+            for (int i = 0; i < 7; ++i) {
+                const auto expected = xrtl::to_glm(xrtl::interpolate(from[i], to[i], 0.3f, method));
+                assert_equal(expected, xrtl::to_glm(result[i]));
+                assert_equal(expected, xrtl::to_glm(in_place[i]));
+            }
+        }
+    }
+
+    TEST_METHOD(test_extrapolate) {
+        const auto dt = 0.25f;
+
+        for (int i = 0; i < 7; ++i) {
+            const auto pose = make_pose(i);
+            XrSpaceVelocity velocity { XR_TYPE_SPACE_VELOCITY };
+            velocity.velocityFlags = XR_SPACE_VELOCITY_LINEAR_VALID_BIT | XR_SPACE_VELOCITY_ANGULAR_VALID_BIT;
+            velocity.linearVelocity = { 1.0f, 0.0f, -0.5f * static_cast<float>(i) };
+            velocity.angularVelocity = { 0.5f, 2.0f * static_cast<float>(i), -1.0f };
+
+            const auto w = xrtl::to_glm(velocity.angularVelocity);
+            const auto q = glm::angleAxis(glm::length(w) * dt, glm::normalize(w)) * xrtl::to_glm(pose.orientation);
+            const auto p = xrtl::to_glm(pose.position) + dt * xrtl::to_glm(velocity.linearVelocity);
+            const auto expected = glm::translate(glm::mat4(1.0f), p) * glm::mat4_cast(q);
+
+            const auto actual = xrtl::extrapolate(pose, velocity, dt);
+            assert_equal(expected, xrtl::to_glm(actual));
+            assert_equal(xrtl::to_glm(pose), xrtl::to_glm(xrtl::extrapolate(actual, velocity, -dt)));
+
+            // Velocities that are not valid must be ignored.
+            velocity.velocityFlags = XR_SPACE_VELOCITY_LINEAR_VALID_BIT;
+            velocity.angularVelocity = { NAN, NAN, NAN };
+            const auto linear = xrtl::extrapolate(pose, velocity, dt);
+            assert_equal(glm::translate(glm::mat4(1.0f), p) * glm::mat4_cast(xrtl::to_glm(pose.orientation)), xrtl::to_glm(linear));
+        }
+
+        XrPosef poses[7];
+        XrSpaceVelocity velocities[7];
+        for (int i = 0; i < 7; ++i) {
+            poses[i] = make_pose(i);
+            velocities[i] = { XR_TYPE_SPACE_VELOCITY };
+            velocities[i].velocityFlags = (i % 3 == 0) ? XR_SPACE_VELOCITY_LINEAR_VALID_BIT : XR_SPACE_VELOCITY_ANGULAR_VALID_BIT;
+            velocities[i].linearVelocity = { 0.1f * static_cast<float>(i), 1.0f, 0.0f };
+            velocities[i].angularVelocity = { 0.0f, 1.0f, static_cast<float>(i) };
+        }
+
+        XrPosef result[7];
+        xrtl::extrapolate(poses, velocities, 7, dt, result);
+
+        XrPosef in_place[7];
+        std::copy(poses, poses + 7, in_place);
+        xrtl::extrapolate(in_place, velocities, 7, dt, in_place);
+
+        for (int i = 0; i < 7; ++i) {
+            const auto expected = xrtl::to_glm(xrtl::extrapolate(poses[i], velocities[i], dt));
+            assert_equal(expected, xrtl::to_glm(result[i]));
+            assert_equal(expected, xrtl::to_glm(in_place[i]));
+        }
+    }
+
+};
+
+}
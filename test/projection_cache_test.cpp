@@ -0,0 +1,100 @@
+﻿// <copyright file="projection_cache_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include <xrtl/glm.h>
+#include <xrtl/projection_cache.h>
+#include <xrtl/xmath.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace xrtltest {
+
+TEST_CLASS(projection_cache_test) {
+
+public:
+
+    TEST_METHOD(test_stereo) {
+        constexpr float near_plane = 0.1f;
+        constexpr float far_plane = 100.0f;
+
+        XrView views[2] = { { XR_TYPE_VIEW }, { XR_TYPE_VIEW } };
+        views[0].fov.angleLeft = -0.9f;
+        views[0].fov.angleRight = 0.7f;
+        views[0].fov.angleUp = 0.8f;
+        views[0].fov.angleDown = -0.85f;
+        views[1].fov.angleLeft = -0.7f;
+        views[1].fov.angleRight = 0.9f;
+        views[1].fov.angleUp = 0.8f;
+        views[1].fov.angleDown = -0.85f;
+
+        auto builder = glm::frustumRH_ZO<float>;
+        xrtl::stereo_projection_cache<decltype(builder)> cache(builder);
+        Assert::AreEqual(0.0, cache.hit_rate(), L"No requests", LINE_INFO());
+
+        cache.update(views, 2, near_plane, far_plane);
+        Assert::AreEqual(std::uint64_t(0), cache.hits(), L"First frame misses", LINE_INFO());
+        Assert::AreEqual(std::uint64_t(2), cache.misses(), L"First frame misses", LINE_INFO());
+
+        for (int i = 0; i < 2; ++i) {
+            const auto expected = xrtl::make_matrix(builder, views[i].fov, near_plane, far_plane);
+            Assert::IsTrue(expected == cache[i], L"Same as make_matrix", LINE_INFO());
+        }
+
+        cache.update(views, 2, near_plane, far_plane);
+        Assert::AreEqual(std::uint64_t(2), cache.hits(), L"Second frame hits", LINE_INFO());
+        Assert::AreEqual(0.5, cache.hit_rate(), L"Hit rate", LINE_INFO());
+
+        views[1].fov.angleUp = 0.81f;
+        const auto& changed = cache.get(1, views[1].fov, near_plane, far_plane);
+        Assert::AreEqual(std::uint64_t(3), cache.misses(), L"Changed fov misses", LINE_INFO());
+        Assert::IsTrue(xrtl::make_matrix(builder, views[1].fov, near_plane, far_plane) == changed, L"Recomputed", LINE_INFO());
+
+        cache.get(1, views[1].fov, near_plane, 1000.0f);
+        Assert::AreEqual(std::uint64_t(4), cache.misses(), L"Changed far plane misses", LINE_INFO());
+
+        cache.invalidate();
+        cache.reset_statistics();
+        cache.update(views, 2, near_plane, far_plane);
+        Assert::AreEqual(std::uint64_t(2), cache.misses(), L"Invalidated", LINE_INFO());
+    }
+
+    TEST_METHOD(test_quad_view) {
+        XrView views[4];
+        for (int i = 0; i < 4; ++i) {
+            views[i] = { XR_TYPE_VIEW };
+            views[i].fov.angleLeft = -0.5f - 0.1f * i;
+            views[i].fov.angleRight = 0.5f;
+            views[i].fov.angleUp = 0.5f;
+            views[i].fov.angleDown = -0.5f;
+        }
+
+        auto builder = DirectX::XMMatrixPerspectiveOffCenterRH;
+        xrtl::quad_view_projection_cache<decltype(builder)> cache(builder);
+        Assert::AreEqual(std::size_t(4), cache.views, L"Four views", LINE_INFO());
+
+        for (int f = 0; f < 10; ++f) {
+            cache.update(views, 4, 0.1f, 100.0f);
+        }
+
+        Assert::AreEqual(std::uint64_t(36), cache.hits(), L"Hits", LINE_INFO());
+        Assert::AreEqual(std::uint64_t(4), cache.misses(), L"Misses", LINE_INFO());
+        Assert::AreEqual(0.9, cache.hit_rate(), 1e-9, L"Hit rate", LINE_INFO());
+    }
+
+    TEST_METHOD(test_invalid) {
+        XrFovf fov { 0.0f, 0.0f, 0.5f, -0.5f };
+        auto builder = glm::frustumRH_ZO<float>;
+        xrtl::projection_cache<decltype(builder)> cache(builder);
+        Assert::ExpectException<std::invalid_argument>([&]() { cache.get(0, fov, 0.1f, 100.0f); }, L"Empty range", LINE_INFO());
+        Assert::ExpectException<std::invalid_argument>([&]() { cache.get(0, fov, 0.1f, 100.0f); }, L"Invalid input is not cached", LINE_INFO());
+    }
+};
+
+}
@@ -20,7 +20,9 @@ public:
 
     TEST_METHOD(test_xr_category) {
         Assert::AreEqual("OpenXR", xrtl::xr_category().name(), L"category name", LINE_INFO());
-        Assert::AreEqual(std::string("1"), xrtl::xr_category().message(XR_TIMEOUT_EXPIRED), L"message w/o instance", LINE_INFO());
+        Assert::AreEqual(std::string("XR_TIMEOUT_EXPIRED"), xrtl::xr_category().message(XR_TIMEOUT_EXPIRED), L"message w/o instance", LINE_INFO());
+        Assert::AreEqual(std::string("XR_ERROR_SESSION_NOT_RUNNING"), xrtl::xr_category().message(XR_ERROR_SESSION_NOT_RUNNING), L"message w/o instance", LINE_INFO());
+        Assert::AreEqual(std::string("XR_UNKNOWN_FAILURE_-42000"), xrtl::xr_category().message(-42000), L"unknown message w/o instance", LINE_INFO());
 
         XrInstanceCreateInfo ci { XR_TYPE_INSTANCE_CREATE_INFO };
         ::strncpy_s(ci.applicationInfo.applicationName, "Test", XR_MAX_APPLICATION_NAME_SIZE);
@@ -35,9 +37,19 @@ public:
         if (XR_SUCCEEDED(::xrCreateInstance(&ci, instance.put()))) {
             xrtl::xr_category_instance(instance.get());
             Assert::AreNotEqual(std::string("1"), xrtl::xr_category().message(XR_TIMEOUT_EXPIRED), L"message w/o instance", LINE_INFO());
+            Assert::AreEqual(std::string("XR_TIMEOUT_EXPIRED"), xrtl::xr_category().message(XR_TIMEOUT_EXPIRED), L"same as table", LINE_INFO());
+            xrtl::xr_category_instance(XR_NULL_HANDLE);
         }
     }
 
+    TEST_METHOD(test_xr_result_name) {
+        static_assert(xrtl::xr_result_name(XR_SUCCESS) != nullptr, "Names are available at compile time.");
+        Assert::AreEqual("XR_SUCCESS", xrtl::xr_result_name(XR_SUCCESS), L"XR_SUCCESS", LINE_INFO());
+        Assert::AreEqual("XR_FRAME_DISCARDED", xrtl::xr_result_name(XR_FRAME_DISCARDED), L"XR_FRAME_DISCARDED", LINE_INFO());
+        Assert::AreEqual("XR_ERROR_VALIDATION_FAILURE", xrtl::xr_result_name(XR_ERROR_VALIDATION_FAILURE), L"XR_ERROR_VALIDATION_FAILURE", LINE_INFO());
+        Assert::IsNull(xrtl::xr_result_name(static_cast<XrResult>(-42000)), L"Unknown code", LINE_INFO());
+    }
+
     TEST_METHOD(test_throw_xr_result) {
         Assert::ExpectException<std::system_error>([](void) {
             THROW_XR_RESULT(XR_TIMEOUT_EXPIRED);
@@ -63,6 +75,39 @@ public:
             THROW_IF_XR_FAILED_MSG(XR_ERROR_VALIDATION_FAILURE, "hurz");
         }, L"THROW_IF_XR_FAILED_MSG", LINE_INFO());
     }
+
+    TEST_METHOD(test_throw_xr_result_conversions) {
+        const std::string message("blah");
+        const int result = XR_ERROR_VALIDATION_FAILURE;
+
+        Assert::ExpectException<std::system_error>([&message](void) {
+            THROW_XR_RESULT_MSG(XR_TIMEOUT_EXPIRED, message);
+        }, L"THROW_XR_RESULT_MSG with std::string", LINE_INFO());
+
+        Assert::ExpectException<std::system_error>([&message](void) {
+            THROW_XR_RESULT_IF_MSG(XR_TIMEOUT_EXPIRED, true, message);
+        }, L"THROW_XR_RESULT_IF_MSG with std::string", LINE_INFO());
+
+        Assert::ExpectException<std::system_error>([&message](void) {
+            THROW_IF_XR_FAILED_MSG(XR_ERROR_VALIDATION_FAILURE, message);
+        }, L"THROW_IF_XR_FAILED_MSG with std::string", LINE_INFO());
+
+        Assert::ExpectException<std::system_error>([result](void) {
+            THROW_XR_RESULT(result);
+        }, L"THROW_XR_RESULT with int", LINE_INFO());
+
+        Assert::ExpectException<std::system_error>([result](void) {
+            THROW_IF_XR_FAILED(result);
+        }, L"THROW_IF_XR_FAILED with int", LINE_INFO());
+
+        try {
+            THROW_XR_RESULT_MSG(result, message + " blubb");
+        } catch (const std::system_error& ex) {
+            Assert::AreEqual(result, ex.code().value(), L"Error code preserved", LINE_INFO());
+            Assert::IsTrue(ex.code().category() == xrtl::xr_category(), L"OpenXR category", LINE_INFO());
+            Assert::AreNotEqual(std::string::npos, std::string(ex.what()).find("blah blubb"), L"Message preserved", LINE_INFO());
+        }
+    }
 };
 
 }
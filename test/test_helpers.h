@@ -0,0 +1,72 @@
+﻿// <copyright file="test_helpers.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_TEST_HELPERS_H)
+#define _TEST_HELPERS_H
+#pragma once
+
+#include "CppUnitTest.h"
+
+#include <cmath>
+
+#include <xrtl/glm.h>
+
+
+namespace xrtltest {
+
+/// <summary>
+/// Asserts that all elements of the given matrices are equal within the
+/// given tolerance.
+/// </summary>
+inline void assert_equal(const glm::mat4& expected, const glm::mat4& actual,
+        const wchar_t *message = L"Matrix element",
+        const float tolerance = 1e-5f) {
+    using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+    for (glm::length_t c = 0; c < 4; ++c) {
+        for (glm::length_t r = 0; r < 4; ++r) {
+            Assert::AreEqual(expected[c][r], actual[c][r], tolerance, message, LINE_INFO());
+        }
+    }
+}
+
+/// <summary>
+/// Asserts that the given vectors are equal.
+/// </summary>
+inline void assert_equal(const glm::vec3& expected, const XrVector3f& actual) {
+    using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+    Assert::AreEqual(expected.x, actual.x, 1e-5f, L"x", LINE_INFO());
+    Assert::AreEqual(expected.y, actual.y, 1e-5f, L"y", LINE_INFO());
+    Assert::AreEqual(expected.z, actual.z, 1e-5f, L"z", LINE_INFO());
+}
+
+/// <summary>
+/// Asserts that the given poses describe the same transformation.
+/// </summary>
+inline void assert_equal(const XrPosef& expected, const XrPosef& actual) {
+    assert_equal(xrtl::to_glm(expected), xrtl::to_glm(actual));
+}
+
+/// <summary>
+/// Creates the <paramref name="i" />-th pose of a deterministic sequence of
+/// rotations about a skew axis and translations along a line.
+/// </summary>
+inline XrPosef make_pose(const int i) {
+    const auto angle = 0.3f * static_cast<float>(i);
+    const auto s = std::sin(angle) / std::sqrt(3.0f);
+    XrPosef retval;
+    retval.orientation.x = s;
+    retval.orientation.y = -s;
+    retval.orientation.z = s;
+    retval.orientation.w = std::cos(angle);
+    retval.position.x = static_cast<float>(i);
+    retval.position.y = 2.0f * static_cast<float>(i);
+    retval.position.z = -1.0f;
+    return retval;
+}
+
+}
+
+#endif /* !defined(_TEST_HELPERS_H) */
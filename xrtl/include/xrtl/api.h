@@ -30,6 +30,23 @@
 #define XRTL_CONCAT(l, r) _XRTL_CONCAT(l, r)
 
 
+/// <summary>
+/// Creates an identifier starting with <paramref name="p" /> that is unique
+/// within the translation unit.
+/// </summary>
+/// <remarks>
+/// The identifier is made unique using <c>__COUNTER__</c>, which allows for
+/// multiple uses on the same line. <c>__LINE__</c> is only used if the
+/// compiler does not support <c>__COUNTER__</c>.
+/// </remarks>
+/// <param name="p">The prefix of the identifier.</param>
+#if defined(__COUNTER__)
+#define XRTL_UNIQUE_NAME(p) XRTL_CONCAT(p, __COUNTER__)
+#else /* defined(__COUNTER__) */
+#define XRTL_UNIQUE_NAME(p) XRTL_CONCAT(p, __LINE__)
+#endif /* defined(__COUNTER__) */
+
+
 /// <summary>
 /// Creates the full ABI versison string.
 /// </summary>
@@ -86,6 +103,57 @@ inline namespace XRTL_ABI_NAMESPACE(XRTL_ABI_MAJOR, XRTL_ABI_MINOR) {
 #define XRTL_DETAIL_NAMESPACE_END } XRTL_NAMESPACE_END
 
 
+/// <summary>
+/// Prevents the compiler from inlining a function.
+/// </summary>
+#if defined(_MSC_VER)
+#define XRTL_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#define XRTL_NOINLINE __attribute__((noinline))
+#else /* defined(_MSC_VER) */
+#define XRTL_NOINLINE
+#endif /* defined(_MSC_VER) */
+
+
+/// <summary>
+/// Marks a function as unlikely to be called, which allows the compiler to
+/// optimise it for size and to move it out of the hot code path.
+/// </summary>
+#if defined(__GNUC__) || defined(__clang__)
+#define XRTL_COLD __attribute__((cold))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define XRTL_COLD
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+
+/// <summary>
+/// Hints the compiler that the given condition is most likely <c>true</c>.
+/// </summary>
+/// <param name="c">The condition to be evaluated.</param>
+#if defined(__GNUC__) || defined(__clang__)
+#define XRTL_LIKELY(c) (__builtin_expect(!!(c), 1))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define XRTL_LIKELY(c) (c)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+
+/// <summary>
+/// Hints the compiler that the given condition is most likely <c>false</c>.
+/// </summary>
+/// <param name="c">The condition to be evaluated.</param>
+#if defined(__GNUC__) || defined(__clang__)
+#define XRTL_UNLIKELY(c) (__builtin_expect(!!(c), 0))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define XRTL_UNLIKELY(c) (c)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+
+// Make the library feature-test macros like __cpp_lib_span available.
+#if __has_include(<version>)
+#include <version>
+#endif /* __has_include(<version>) */
+
+
 #if defined(_WIN32)
 #include <sal.h>
 
@@ -13,6 +13,8 @@
 #include <stdexcept>
 
 #include "xrtl/debug_policy.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/extension_functions.h"
 #include "xrtl/initialise.h"
 #include "xrtl/result.h"
 
@@ -24,13 +26,30 @@ XRTL_NAMESPACE_BEGIN
 /// </summary>
 /// <typeparam name="Policy">Configures how the messenger behaves if it cannot
 /// create the underlying API object.</typeparam>
-template<debug_policy Policy> class debug_messenger final {
+/// <typeparam name="TErrorPolicy">Configures how failures of a
+/// <see cref="debug_policy::required" /> messenger are reported. If the error
+/// policy returns from a failure, the messenger remains empty and
+/// <see cref="debug_messenger::result" /> reports the cause.</typeparam>
+/// <remarks>
+/// The messenger keeps its own copy of the resolved
+/// <c>xrDestroyDebugUtilsMessengerEXT</c>. It does not reference the
+/// <see cref="extension_functions" /> it has been created from after the
+/// constructor returned, so the cache may be destroyed before the messenger.
+/// </remarks>
+template<debug_policy Policy, class TErrorPolicy = default_error_policy>
+class debug_messenger final {
 
 public:
 
     /// <summary>
     /// Initialises a new instance.
     /// </summary>
+    /// <remarks>
+    /// The extension functions are resolved via the loader for this
+    /// messenger only. Use the overload accepting
+    /// <see cref="extension_functions" /> to share the resolved functions
+    /// with other objects of the same instance.
+    /// </remarks>
     /// <param name="instance">The OpenXR instance to create the messenger from.
     /// </param>
     /// <param name="create_info">The configuration of the messenger.</param>
@@ -40,6 +59,12 @@ public:
     /// <summary>
     /// Initialises a new instance.
     /// </summary>
+    /// <remarks>
+    /// The extension functions are resolved via the loader for this
+    /// messenger only. Use the overload accepting
+    /// <see cref="extension_functions" /> to share the resolved functions
+    /// with other objects of the same instance.
+    /// </remarks>
     /// <typeparam name="TCallback">The type of the callback functor.
     /// </typeparam>
     /// <param name="instance">The OpenXR instance to create the messenger from.
@@ -56,6 +81,37 @@ public:
         _In_ const XrDebugUtilsMessageTypeFlagsEXT types,
         _In_ void *context = nullptr);
 
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="functions">The extension function cache of the OpenXR
+    /// instance to create the messenger from, which is only used during the
+    /// construction.</param>
+    /// <param name="create_info">The configuration of the messenger.</param>
+    debug_messenger(_In_ const extension_functions& functions,
+        _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info);
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <typeparam name="TCallback">The type of the callback functor.
+    /// </typeparam>
+    /// <param name="functions">The extension function cache of the OpenXR
+    /// instance to create the messenger from, which is only used during the
+    /// construction.</param>
+    /// <param name="callback">The callback to be invoked if a message was
+    /// received.</param>
+    /// <param name="severities">The message severities to be reported.</param>
+    /// <param name="types">The message types to be reported.</param>
+    /// <param name="context">A context pointer to be passed to the
+    /// <paramref name="callback" />.</param>
+    template<class TCallback> debug_messenger(
+        _In_ const extension_functions& functions,
+        _In_ const TCallback& callback,
+        _In_ const XrDebugUtilsMessageSeverityFlagsEXT severities,
+        _In_ const XrDebugUtilsMessageTypeFlagsEXT types,
+        _In_ void *context = nullptr);
+
     debug_messenger(const debug_messenger&) = delete;
 
     /// <summary>
@@ -63,18 +119,37 @@ public:
     /// </summary>
     ~debug_messenger(void) noexcept;
 
+    /// <summary>
+    /// Answer whether the messenger has been created.
+    /// </summary>
+    /// <returns><c>true</c> if the underlying API object exists,
+    /// <c>false</c> otherwise.</returns>
+    inline bool valid(void) const noexcept {
+        return (this->_handle != XR_NULL_HANDLE);
+    }
+
+    /// <summary>
+    /// Gets the result of the creation of the messenger.
+    /// </summary>
+    /// <returns>The result of the creation, which is a failure code if the
+    /// messenger could not be created.</returns>
+    inline XrResult result(void) const noexcept {
+        return this->_result;
+    }
+
     debug_messenger& operator =(const debug_messenger&) = delete;
 
 private:
 
-    inline void create(_In_ XrInstance instance,
+    inline void create(_In_ const extension_functions& functions,
         _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info);
 
     inline PFN_xrCreateDebugUtilsMessengerEXT load(
-        _In_ XrInstance instance);
+        _In_ const extension_functions& functions);
 
     PFN_xrDestroyDebugUtilsMessengerEXT _destroy;
     XrDebugUtilsMessengerEXT _handle;
+    XrResult _result;
 };
 
 
@@ -189,11 +264,56 @@ inline std::unique_ptr<debug_messenger<Policy>> make_debug_messenger(
         severities, types, context);
 }
 
+/// <summary>
+/// Creates a debug messenger for the given OpenXR instance.
+/// </summary>
+/// <typeparam name="Policy">Configures how the messenger behaves if it cannot
+/// create the underlying API object.</typeparam>
+/// <param name="functions">The extension function cache of the OpenXR
+/// instance to create the messenger from.</param>
+/// <param name="create_info">The configuration of the messenger.</param>
+/// <returns>A debug messenger with the given configuration.</returns>
+template<debug_policy Policy>
+inline std::unique_ptr<debug_messenger<Policy>> make_debug_messenger(
+        _In_ const extension_functions& functions,
+        _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info) {
+    return std::make_unique<debug_messenger<Policy>>(functions, create_info);
+}
+
+/// <summary>
+/// Creates a debug messenger for the given OpenXR instance.
+/// </summary>
+/// <typeparam name="Policy">Configures how the messenger behaves if it cannot
+/// create the underlying API object.</typeparam>
+/// <typeparam name="TCallback">The type of the callback functor.</typeparam>
+/// <param name="functions">The extension function cache of the OpenXR
+/// instance to create the messenger from.</param>
+/// <param name="callback">The callback to be invoked if a message was received.
+/// </param>
+/// <param name="severities">The message severities to be reported.</param>
+/// <param name="types">The message types to be reported.</param>
+/// <param name="context">A context pointer to be passed to the
+/// <paramref name="callback" />.</param>
+/// <returns>A debug messenger with the given configuration.</returns>
+template<debug_policy Policy, class TCallback>
+inline std::unique_ptr<debug_messenger<Policy>> make_debug_messenger(
+        _In_ const extension_functions& functions,
+        _In_ const TCallback& callback,
+        _In_ const XrDebugUtilsMessageSeverityFlagsEXT severities
+            = default_debug_severities,
+        _In_ const XrDebugUtilsMessageTypeFlagsEXT types
+            = default_debug_types,
+        _In_ void *context = nullptr) {
+    return std::make_unique<debug_messenger<Policy>>(functions, callback,
+        severities, types, context);
+}
+
 /// <summary>
 /// Creates a debug messenger for the given OpenXR instance.
 /// </summary>
 /// <typeparam name="TInstance">The type of the OpenXR instance, which can
-/// either be a native <c>XrInstance</c> or a unique handle for it.</typeparam>
+/// either be a native <c>XrInstance</c>, a unique handle for it or its
+/// <see cref="extension_functions" />.</typeparam>
 /// <param name="instance">The OpenXR instance to create the messenger from.
 /// </param>
 /// <param name="create_info">The configuration of the messenger.</param>
@@ -210,7 +330,8 @@ make_mandatory_debug_messenger(_In_ TInstance&& instance,
 /// Creates a debug messenger for the given OpenXR instance.
 /// </summary>
 /// <typeparam name="TInstance">The type of the OpenXR instance, which can
-/// either be a native <c>XrInstance</c> or a unique handle for it.</typeparam>
+/// either be a native <c>XrInstance</c>, a unique handle for it or its
+/// <see cref="extension_functions" />.</typeparam>
 /// <typeparam name="TCallback">The type of the callback functor.</typeparam>
 /// <param name="instance">The OpenXR instance to create the messenger from.
 /// </param>
@@ -242,7 +363,8 @@ make_mandatory_debug_messenger(_In_ TInstance&& instance,
 /// Creates a debug messenger for the given OpenXR instance.
 /// </summary>
 /// <typeparam name="TInstance">The type of the OpenXR instance, which can
-/// either be a native <c>XrInstance</c> or a unique handle for it.</typeparam>
+/// either be a native <c>XrInstance</c>, a unique handle for it or its
+/// <see cref="extension_functions" />.</typeparam>
 /// <param name="instance">The OpenXR instance to create the messenger from.
 /// </param>
 /// <param name="create_info">The configuration of the messenger.</param>
@@ -259,7 +381,8 @@ make_optional_debug_messenger(_In_ TInstance&& instance,
 /// Creates a debug messenger for the given OpenXR instance.
 /// </summary>
 /// <typeparam name="TInstance">The type of the OpenXR instance, which can
-/// either be a native <c>XrInstance</c> or a unique handle for it.</typeparam>
+/// either be a native <c>XrInstance</c>, a unique handle for it or its
+/// <see cref="extension_functions" />.</typeparam>
 /// <typeparam name="TCallback">The type of the callback functor.</typeparam>
 /// <param name="instance">The OpenXR instance to create the messenger from.
 /// </param>
@@ -6,45 +6,72 @@
 
 
 /*
- * XRTL_NAMESPACE::debug_messenger<Policy>::debug_messenger
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger
  */
-template<XRTL_NAMESPACE::debug_policy Policy>
-XRTL_NAMESPACE::debug_messenger<Policy>::debug_messenger(
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger(
         _In_ XrInstance instance,
         _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info)
+    : debug_messenger(extension_functions(instance), create_info) { }
+
+
+/*
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger
+ */
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+template<class TCallback>
+XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger(
+        _In_ XrInstance instance,
+        _In_ const TCallback &callback,
+        _In_ const XrDebugUtilsMessageSeverityFlagsEXT severities,
+        _In_ const XrDebugUtilsMessageTypeFlagsEXT types,
+        _In_ void *context)
+    : debug_messenger(extension_functions(instance), callback, severities,
+        types, context) { }
+
+
+/*
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger
+ */
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger(
+        _In_ const extension_functions& functions,
+        _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info)
     : _destroy(nullptr),
-        _handle(XR_NULL_HANDLE) {
-    this->create(instance, create_info);
+        _handle(XR_NULL_HANDLE),
+        _result(XR_SUCCESS) {
+    this->create(functions, create_info);
 }
 
 
 /*
- * XRTL_NAMESPACE::debug_messenger<Policy>::debug_messenger
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger
  */
-template<XRTL_NAMESPACE::debug_policy Policy>
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
 template<class TCallback>
-XRTL_NAMESPACE::debug_messenger<Policy>::debug_messenger(
-        _In_ XrInstance instance,
+XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::debug_messenger(
+        _In_ const extension_functions& functions,
         _In_ const TCallback &callback,
         _In_ const XrDebugUtilsMessageSeverityFlagsEXT severities,
         _In_ const XrDebugUtilsMessageTypeFlagsEXT types,
         _In_ void *context)
     : _destroy(nullptr),
-        _handle(XR_NULL_HANDLE) {
+        _handle(XR_NULL_HANDLE),
+        _result(XR_SUCCESS) {
     auto create_info = init_xrstruct<XrDebugUtilsMessengerCreateInfoEXT>();
     create_info.messageTypes = types;
     create_info.messageSeverities = severities;
     create_info.userCallback = callback;
     create_info.userData = context;
-    this->create(instance, create_info);
+    this->create(functions, create_info);
 }
 
 
 /*
- * XRTL_NAMESPACE::debug_messenger<Policy>::~debug_messenger
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::~debug_messenger
  */
-template<XRTL_NAMESPACE::debug_policy Policy>
-XRTL_NAMESPACE::debug_messenger<Policy>::~debug_messenger(void) noexcept {
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::~debug_messenger(void) noexcept {
     if ((this->_destroy != nullptr) && (this->_handle != XR_NULL_HANDLE)) {
         this->_destroy(this->_handle);
     }
@@ -52,62 +79,69 @@ XRTL_NAMESPACE::debug_messenger<Policy>::~debug_messenger(void) noexcept {
 
 
 /*
- * XRTL_NAMESPACE::debug_messenger<Policy>::create
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::create
  */
-template<XRTL_NAMESPACE::debug_policy Policy>
-void XRTL_NAMESPACE::debug_messenger<Policy>::create(_In_ XrInstance instance,
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+void XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::create(
+        _In_ const extension_functions& functions,
         _In_ const XrDebugUtilsMessengerCreateInfoEXT& create_info) {
+    const auto instance = functions.instance();
     assert(this->_handle == XR_NULL_HANDLE);
     assert(instance != XR_NULL_HANDLE);
 
-    if ((instance == XR_NULL_HANDLE) && (Policy == debug_policy::required)) {
-        throw std::invalid_argument("A valid OpenXR instance is required.");
+    if (instance == XR_NULL_HANDLE) {
+        this->_result = XR_ERROR_HANDLE_INVALID;
+        if (Policy == debug_policy::required) {
+            TErrorPolicy::on_invalid_argument(
+                "A valid OpenXR instance is required.");
+        }
+        return;
     }
 
-    if (instance != XR_NULL_HANDLE) {
-        auto create = this->load(instance);
-        if (create != nullptr) {
-            assert(this->_destroy != XR_NULL_HANDLE);
-            auto status = create(instance, &create_info, &this->_handle);
-            THROW_XR_RESULT_IF_MSG(status,
-                XR_FAILED(status) && (Policy == debug_policy::required),
-                "Failed to create debug messenger.");
+    auto create = this->load(functions);
+    if (create != nullptr) {
+        assert(this->_destroy != XR_NULL_HANDLE);
+        this->_result = create(instance, &create_info, &this->_handle);
+        if (XR_FAILED(this->_result)) {
+            this->_handle = XR_NULL_HANDLE;
+            if (Policy == debug_policy::required) {
+                TErrorPolicy::on_failure(this->_result,
+                    "Failed to create debug messenger.");
+            }
         }
     }
 }
 
 
 /*
- * XRTL_NAMESPACE::debug_messenger<Policy>::load
+ * XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::load
  */
-template<XRTL_NAMESPACE::debug_policy Policy>
-PFN_xrCreateDebugUtilsMessengerEXT XRTL_NAMESPACE::debug_messenger<Policy>::load(
-        _In_ XrInstance instance) {
-    assert(instance != XR_NULL_HANDLE);
+template<XRTL_NAMESPACE::debug_policy Policy, class TErrorPolicy>
+PFN_xrCreateDebugUtilsMessengerEXT XRTL_NAMESPACE::debug_messenger<Policy, TErrorPolicy>::load(
+        _In_ const extension_functions& functions) {
+    assert(functions.instance() != XR_NULL_HANDLE);
     assert(this->_destroy == nullptr);
 
-    {
-        auto status = ::xrGetInstanceProcAddr(instance,
-            "xrDestroyDebugUtilsMessengerEXT",
-            reinterpret_cast<PFN_xrVoidFunction *>(&this->_destroy));
-        if (XR_FAILED(status)) {
-            THROW_XR_RESULT_IF_MSG(status, Policy == debug_policy::required,
+    this->_destroy = functions.get<
+        xr_extension_function::xrDestroyDebugUtilsMessengerEXT>();
+    if (this->_destroy == nullptr) {
+        this->_result = XR_ERROR_FUNCTION_UNSUPPORTED;
+        if (Policy == debug_policy::required) {
+            TErrorPolicy::on_failure(this->_result,
                 "Failed to obtain address of xrDestroyDebugUtilsMessengerEXT");
-            return nullptr;
         }
+        return nullptr;
     }
 
-    {
-        PFN_xrCreateDebugUtilsMessengerEXT retval;
-        auto status = ::xrGetInstanceProcAddr(instance,
-            "xrCreateDebugUtilsMessengerEXT",
-            reinterpret_cast<PFN_xrVoidFunction *>(&retval));
-        if (XR_FAILED(status)) {
-            THROW_XR_RESULT_IF_MSG(status, Policy == debug_policy::required,
+    auto retval = functions.get<
+        xr_extension_function::xrCreateDebugUtilsMessengerEXT>();
+    if (retval == nullptr) {
+        this->_result = XR_ERROR_FUNCTION_UNSUPPORTED;
+        if (Policy == debug_policy::required) {
+            TErrorPolicy::on_failure(this->_result,
                 "Failed to obtain address of xrCreateDebugUtilsMessengerEXT");
-            return nullptr;
         }
-
-        return retval;
     }
+
+    return retval;
 }
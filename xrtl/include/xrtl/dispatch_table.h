@@ -0,0 +1,184 @@
+﻿// <copyright file="dispatch_table.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_DISPATCH_TABLE_H)
+#define _XRTL_DISPATCH_TABLE_H
+#pragma once
+
+#include <cassert>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/result.h"
+#include "xrtl/unique_handle.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A table of the OpenXR core functions resolved for a specific
+/// <see cref="XrInstance" />.
+/// </summary>
+/// <remarks>
+/// <para>The functions exported by the OpenXR loader are trampolines, which
+/// look up the dispatch table of the handle passed in on every call. The
+/// pointers in this table are obtained via <c>xrGetInstanceProcAddr</c> once
+/// and therefore call the runtime (or the topmost API layer) directly.</para>
+/// <para>The table is only valid as long as the instance it has been created
+/// for is alive.</para>
+/// </remarks>
+class dispatch_table final {
+
+public:
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    dispatch_table(void) noexcept = default;
+
+    /// <summary>
+    /// Initialises a new instance by resolving all core functions for the
+    /// given <paramref name="instance" />.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to resolve the functions
+    /// for.</param>
+    /// <exception cref="std::system_error">If any of the core functions could
+    /// not be resolved.</exception>
+    explicit dispatch_table(_In_ const XrInstance instance);
+
+    /// <summary>
+    /// Initialises a new instance by resolving all core functions for the
+    /// given <paramref name="instance" />.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to resolve the functions
+    /// for.</param>
+    /// <exception cref="std::system_error">If any of the core functions could
+    /// not be resolved.</exception>
+    inline explicit dispatch_table(_In_ const unique_instance& instance)
+        : dispatch_table(instance.get()) { }
+
+    /// <summary>
+    /// Answer whether the table has not been filled.
+    /// </summary>
+    /// <returns><c>true</c> if the table has no instance, <c>false</c>
+    /// otherwise.</returns>
+    inline bool empty(void) const noexcept {
+        return (this->_instance == XR_NULL_HANDLE);
+    }
+
+    /// <summary>
+    /// Gets the instance the table has been filled for.
+    /// </summary>
+    /// <returns>The OpenXR instance.</returns>
+    inline XrInstance instance(void) const noexcept {
+        return this->_instance;
+    }
+
+    /// <summary>
+    /// Resolves the function with the given name, which is typically an
+    /// entry point of an enabled extension.
+    /// </summary>
+    /// <typeparam name="TFunction">The <c>PFN_</c> type of the function.
+    /// </typeparam>
+    /// <param name="name">The name of the function to resolve.</param>
+    /// <returns>The function pointer or <c>nullptr</c> if the function is not
+    /// available, e.g. because its extension has not been enabled.</returns>
+    template<class TFunction>
+    TFunction resolve(_In_z_ const char *name) const noexcept;
+
+    /// <summary>
+    /// Answer whether the table has been filled.
+    /// </summary>
+    /// <returns><c>true</c> if the table is valid, <c>false</c> otherwise.
+    /// </returns>
+    inline operator bool(void) const noexcept {
+        return !this->empty();
+    }
+
+    PFN_xrGetInstanceProcAddr xrGetInstanceProcAddr = nullptr;
+    PFN_xrDestroyInstance xrDestroyInstance = nullptr;
+    PFN_xrGetInstanceProperties xrGetInstanceProperties = nullptr;
+    PFN_xrPollEvent xrPollEvent = nullptr;
+    PFN_xrResultToString xrResultToString = nullptr;
+    PFN_xrStructureTypeToString xrStructureTypeToString = nullptr;
+    PFN_xrGetSystem xrGetSystem = nullptr;
+    PFN_xrGetSystemProperties xrGetSystemProperties = nullptr;
+    PFN_xrEnumerateEnvironmentBlendModes xrEnumerateEnvironmentBlendModes
+        = nullptr;
+    PFN_xrCreateSession xrCreateSession = nullptr;
+    PFN_xrDestroySession xrDestroySession = nullptr;
+    PFN_xrEnumerateReferenceSpaces xrEnumerateReferenceSpaces = nullptr;
+    PFN_xrCreateReferenceSpace xrCreateReferenceSpace = nullptr;
+    PFN_xrGetReferenceSpaceBoundsRect xrGetReferenceSpaceBoundsRect = nullptr;
+    PFN_xrCreateActionSpace xrCreateActionSpace = nullptr;
+    PFN_xrLocateSpace xrLocateSpace = nullptr;
+    PFN_xrDestroySpace xrDestroySpace = nullptr;
+    PFN_xrEnumerateViewConfigurations xrEnumerateViewConfigurations = nullptr;
+    PFN_xrGetViewConfigurationProperties xrGetViewConfigurationProperties
+        = nullptr;
+    PFN_xrEnumerateViewConfigurationViews xrEnumerateViewConfigurationViews
+        = nullptr;
+    PFN_xrEnumerateSwapchainFormats xrEnumerateSwapchainFormats = nullptr;
+    PFN_xrCreateSwapchain xrCreateSwapchain = nullptr;
+    PFN_xrDestroySwapchain xrDestroySwapchain = nullptr;
+    PFN_xrEnumerateSwapchainImages xrEnumerateSwapchainImages = nullptr;
+    PFN_xrAcquireSwapchainImage xrAcquireSwapchainImage = nullptr;
+    PFN_xrWaitSwapchainImage xrWaitSwapchainImage = nullptr;
+    PFN_xrReleaseSwapchainImage xrReleaseSwapchainImage = nullptr;
+    PFN_xrBeginSession xrBeginSession = nullptr;
+    PFN_xrEndSession xrEndSession = nullptr;
+    PFN_xrRequestExitSession xrRequestExitSession = nullptr;
+    PFN_xrWaitFrame xrWaitFrame = nullptr;
+    PFN_xrBeginFrame xrBeginFrame = nullptr;
+    PFN_xrEndFrame xrEndFrame = nullptr;
+    PFN_xrLocateViews xrLocateViews = nullptr;
+    PFN_xrStringToPath xrStringToPath = nullptr;
+    PFN_xrPathToString xrPathToString = nullptr;
+    PFN_xrCreateActionSet xrCreateActionSet = nullptr;
+    PFN_xrDestroyActionSet xrDestroyActionSet = nullptr;
+    PFN_xrCreateAction xrCreateAction = nullptr;
+    PFN_xrDestroyAction xrDestroyAction = nullptr;
+    PFN_xrSuggestInteractionProfileBindings xrSuggestInteractionProfileBindings
+        = nullptr;
+    PFN_xrAttachSessionActionSets xrAttachSessionActionSets = nullptr;
+    PFN_xrGetCurrentInteractionProfile xrGetCurrentInteractionProfile = nullptr;
+    PFN_xrGetActionStateBoolean xrGetActionStateBoolean = nullptr;
+    PFN_xrGetActionStateFloat xrGetActionStateFloat = nullptr;
+    PFN_xrGetActionStateVector2f xrGetActionStateVector2f = nullptr;
+    PFN_xrGetActionStatePose xrGetActionStatePose = nullptr;
+    PFN_xrSyncActions xrSyncActions = nullptr;
+    PFN_xrEnumerateBoundSourcesForAction xrEnumerateBoundSourcesForAction
+        = nullptr;
+    PFN_xrGetInputSourceLocalizedName xrGetInputSourceLocalizedName = nullptr;
+    PFN_xrApplyHapticFeedback xrApplyHapticFeedback = nullptr;
+    PFN_xrStopHapticFeedback xrStopHapticFeedback = nullptr;
+#if defined(XR_VERSION_1_1)
+    PFN_xrLocateSpaces xrLocateSpaces = nullptr;
+#endif /* defined(XR_VERSION_1_1) */
+
+private:
+
+    XrInstance _instance = XR_NULL_HANDLE;
+};
+
+
+/// <summary>
+/// Sets the <paramref name="table" /> in the OpenXR error category such that
+/// the category can retrieve an error string without going through the
+/// loader.
+/// </summary>
+/// <param name="table">The dispatch table to be used. If you destroy the
+/// instance of the table, call <see cref="xr_category_instance" /> with
+/// <c>XR_NULL_HANDLE</c>.</param>
+inline void xr_category_instance(_In_ const dispatch_table& table) {
+    xr_category_instance(table.instance(), table.xrResultToString);
+}
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/dispatch_table.inl"
+
+#endif /* !defined(_XRTL_DISPATCH_TABLE_H) */
@@ -0,0 +1,107 @@
+﻿// <copyright file="dispatch_table.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::dispatch_table::dispatch_table
+ */
+inline XRTL_NAMESPACE::dispatch_table::dispatch_table(
+        _In_ const XrInstance instance) {
+    assert(instance != XR_NULL_HANDLE);
+
+    const auto load = [instance](const char *name, auto& function) {
+        auto status = ::xrGetInstanceProcAddr(instance, name,
+            reinterpret_cast<PFN_xrVoidFunction *>(&function));
+        THROW_IF_XR_FAILED_MSG(status, name);
+    };
+
+    load("xrGetInstanceProcAddr", this->xrGetInstanceProcAddr);
+    load("xrDestroyInstance", this->xrDestroyInstance);
+    load("xrGetInstanceProperties", this->xrGetInstanceProperties);
+    load("xrPollEvent", this->xrPollEvent);
+    load("xrResultToString", this->xrResultToString);
+    load("xrStructureTypeToString", this->xrStructureTypeToString);
+    load("xrGetSystem", this->xrGetSystem);
+    load("xrGetSystemProperties", this->xrGetSystemProperties);
+    load("xrEnumerateEnvironmentBlendModes",
+        this->xrEnumerateEnvironmentBlendModes);
+    load("xrCreateSession", this->xrCreateSession);
+    load("xrDestroySession", this->xrDestroySession);
+    load("xrEnumerateReferenceSpaces", this->xrEnumerateReferenceSpaces);
+    load("xrCreateReferenceSpace", this->xrCreateReferenceSpace);
+    load("xrGetReferenceSpaceBoundsRect", this->xrGetReferenceSpaceBoundsRect);
+    load("xrCreateActionSpace", this->xrCreateActionSpace);
+    load("xrLocateSpace", this->xrLocateSpace);
+    load("xrDestroySpace", this->xrDestroySpace);
+    load("xrEnumerateViewConfigurations", this->xrEnumerateViewConfigurations);
+    load("xrGetViewConfigurationProperties",
+        this->xrGetViewConfigurationProperties);
+    load("xrEnumerateViewConfigurationViews",
+        this->xrEnumerateViewConfigurationViews);
+    load("xrEnumerateSwapchainFormats", this->xrEnumerateSwapchainFormats);
+    load("xrCreateSwapchain", this->xrCreateSwapchain);
+    load("xrDestroySwapchain", this->xrDestroySwapchain);
+    load("xrEnumerateSwapchainImages", this->xrEnumerateSwapchainImages);
+    load("xrAcquireSwapchainImage", this->xrAcquireSwapchainImage);
+    load("xrWaitSwapchainImage", this->xrWaitSwapchainImage);
+    load("xrReleaseSwapchainImage", this->xrReleaseSwapchainImage);
+    load("xrBeginSession", this->xrBeginSession);
+    load("xrEndSession", this->xrEndSession);
+    load("xrRequestExitSession", this->xrRequestExitSession);
+    load("xrWaitFrame", this->xrWaitFrame);
+    load("xrBeginFrame", this->xrBeginFrame);
+    load("xrEndFrame", this->xrEndFrame);
+    load("xrLocateViews", this->xrLocateViews);
+    load("xrStringToPath", this->xrStringToPath);
+    load("xrPathToString", this->xrPathToString);
+    load("xrCreateActionSet", this->xrCreateActionSet);
+    load("xrDestroyActionSet", this->xrDestroyActionSet);
+    load("xrCreateAction", this->xrCreateAction);
+    load("xrDestroyAction", this->xrDestroyAction);
+    load("xrSuggestInteractionProfileBindings",
+        this->xrSuggestInteractionProfileBindings);
+    load("xrAttachSessionActionSets", this->xrAttachSessionActionSets);
+    load("xrGetCurrentInteractionProfile",
+        this->xrGetCurrentInteractionProfile);
+    load("xrGetActionStateBoolean", this->xrGetActionStateBoolean);
+    load("xrGetActionStateFloat", this->xrGetActionStateFloat);
+    load("xrGetActionStateVector2f", this->xrGetActionStateVector2f);
+    load("xrGetActionStatePose", this->xrGetActionStatePose);
+    load("xrSyncActions", this->xrSyncActions);
+    load("xrEnumerateBoundSourcesForAction",
+        this->xrEnumerateBoundSourcesForAction);
+    load("xrGetInputSourceLocalizedName", this->xrGetInputSourceLocalizedName);
+    load("xrApplyHapticFeedback", this->xrApplyHapticFeedback);
+    load("xrStopHapticFeedback", this->xrStopHapticFeedback);
+    this->_instance = instance;
+
+#if defined(XR_VERSION_1_1)
+    // xrLocateSpaces is only available if the runtime supports OpenXR 1.1, so
+    // we do not fail if it is missing.
+    this->xrLocateSpaces = this->resolve<PFN_xrLocateSpaces>("xrLocateSpaces");
+#endif /* defined(XR_VERSION_1_1) */
+}
+
+
+/*
+ * XRTL_NAMESPACE::dispatch_table::resolve
+ */
+template<class TFunction>
+TFunction XRTL_NAMESPACE::dispatch_table::resolve(
+        _In_z_ const char *name) const noexcept {
+    assert(name != nullptr);
+    TFunction retval = nullptr;
+
+    if (this->xrGetInstanceProcAddr != nullptr) {
+        auto status = this->xrGetInstanceProcAddr(this->_instance, name,
+            reinterpret_cast<PFN_xrVoidFunction *>(&retval));
+        if (XR_FAILED(status)) {
+            retval = nullptr;
+        }
+    }
+
+    return retval;
+}
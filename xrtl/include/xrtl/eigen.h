@@ -0,0 +1,354 @@
+﻿// <copyright file="eigen.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_EIGEN_H)
+#define _XRTL_EIGEN_H
+#pragma once
+
+#if defined(XRTL_WITH_EIGEN)
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/simd.h"
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Determines the number of floats in an OpenXR vector type, which is the
+/// number of rows of its Eigen view.
+/// </summary>
+template<class TType> struct eigen_rows { };
+
+template<> struct eigen_rows<XrVector2f>
+    : std::integral_constant<Eigen::Index, 2> { };
+template<> struct eigen_rows<XrVector3f>
+    : std::integral_constant<Eigen::Index, 3> { };
+template<> struct eigen_rows<XrVector4f>
+    : std::integral_constant<Eigen::Index, 4> { };
+template<> struct eigen_rows<XrQuaternionf>
+    : std::integral_constant<Eigen::Index, 4> { };
+
+/// <summary>
+/// The Eigen view of an array of <typeparamref name="TType" />, which holds
+/// one element per column and is <c>const</c> if the elements are.
+/// </summary>
+template<class TType>
+using eigen_array_map_t = Eigen::Map<std::conditional_t<
+    std::is_const<TType>::value,
+    const Eigen::Matrix<float, eigen_rows<std::remove_const_t<TType>>::value,
+        Eigen::Dynamic>,
+    Eigen::Matrix<float, eigen_rows<std::remove_const_t<TType>>::value,
+        Eigen::Dynamic>>>;
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// An Eigen view of the positions or orientations of an array of poses,
+/// which holds one element per column.
+/// </summary>
+/// <remarks>
+/// The columns are seven floats apart, because the positions and
+/// orientations of the poses are interleaved.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix, which is
+/// <c>Eigen::Matrix3Xf</c> for positions and <c>Eigen::Matrix4Xf</c> for
+/// orientations, optionally <c>const</c>.</typeparam>
+template<class TMatrix>
+using eigen_pose_map = Eigen::Map<TMatrix, Eigen::Unaligned,
+    Eigen::OuterStride<7>>;
+
+
+/// <summary>
+/// Views an OpenXR 2D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<Eigen::Vector2f> as_eigen(_Inout_ XrVector2f& v) noexcept {
+    return Eigen::Map<Eigen::Vector2f>(detail::simd_floats<XrVector2f, 2>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR 2D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<const Eigen::Vector2f> as_eigen(
+        _In_ const XrVector2f& v) noexcept {
+    return Eigen::Map<const Eigen::Vector2f>(
+        detail::simd_floats<XrVector2f, 2>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR 3D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<Eigen::Vector3f> as_eigen(_Inout_ XrVector3f& v) noexcept {
+    return Eigen::Map<Eigen::Vector3f>(detail::simd_floats<XrVector3f, 3>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR 3D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<const Eigen::Vector3f> as_eigen(
+        _In_ const XrVector3f& v) noexcept {
+    return Eigen::Map<const Eigen::Vector3f>(
+        detail::simd_floats<XrVector3f, 3>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR 4D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<Eigen::Vector4f> as_eigen(_Inout_ XrVector4f& v) noexcept {
+    return Eigen::Map<Eigen::Vector4f>(detail::simd_floats<XrVector4f, 4>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR 4D vector as an Eigen vector without copying.
+/// </summary>
+/// <param name="v">The OpenXR vector to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+inline Eigen::Map<const Eigen::Vector4f> as_eigen(
+        _In_ const XrVector4f& v) noexcept {
+    return Eigen::Map<const Eigen::Vector4f>(
+        detail::simd_floats<XrVector4f, 4>(v));
+}
+
+
+/// <summary>
+/// Views an OpenXR quaternion as an Eigen quaternion without copying.
+/// </summary>
+/// <remarks>
+/// Eigen stores the coefficients of quaternions in the same order as
+/// OpenXR, ie the real part last.
+/// </remarks>
+/// <param name="q">The OpenXR quaternion to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="q" />.</returns>
+inline Eigen::Map<Eigen::Quaternionf> as_eigen(
+        _Inout_ XrQuaternionf& q) noexcept {
+    return Eigen::Map<Eigen::Quaternionf>(
+        detail::simd_floats<XrQuaternionf, 4>(q));
+}
+
+
+/// <summary>
+/// Views an OpenXR quaternion as an Eigen quaternion without copying.
+/// </summary>
+/// <param name="q">The OpenXR quaternion to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="q" />.</returns>
+inline Eigen::Map<const Eigen::Quaternionf> as_eigen(
+        _In_ const XrQuaternionf& q) noexcept {
+    return Eigen::Map<const Eigen::Quaternionf>(
+        detail::simd_floats<XrQuaternionf, 4>(q));
+}
+
+
+/// <summary>
+/// Views an array of OpenXR vectors or quaternions as an Eigen matrix
+/// without copying, which holds one element per column.
+/// </summary>
+/// <remarks>
+/// <para>The result can be used in Eigen expressions like any other matrix,
+/// for instance to transform all vectors by an <c>Eigen::Isometry3f</c> at
+/// once.</para>
+/// <para>The coefficients of quaternions are in the order of
+/// <c>Eigen::Quaternionf::coeffs</c>, ie x, y, z and w.</para>
+/// </remarks>
+/// <typeparam name="TType">The OpenXR type, which must be
+/// <c>XrVector2f</c>, <c>XrVector3f</c>, <c>XrVector4f</c> or
+/// <c>XrQuaternionf</c> and may be <c>const</c>.</typeparam>
+/// <param name="v">The OpenXR vectors to be viewed.</param>
+/// <param name="cnt">The number of elements in <paramref name="v" />.
+/// </param>
+/// <returns>An Eigen map aliasing <paramref name="v" />.</returns>
+template<class TType>
+inline detail::eigen_array_map_t<TType> as_eigen(
+        _Inout_updates_(cnt) TType *v,
+        _In_ const std::size_t cnt) noexcept {
+    typedef std::remove_const_t<TType> xr_type;
+    constexpr auto rows = detail::eigen_rows<xr_type>::value;
+    static_assert(std::is_trivially_copyable<xr_type>::value, "The OpenXR "
+        "type is assumed to be a POD type.");
+    static_assert(sizeof(xr_type) == rows * sizeof(float), "The OpenXR type "
+        "is assumed to consist of floats only.");
+    assert((v != nullptr) || (cnt == 0));
+
+    typedef std::conditional_t<std::is_const<TType>::value, const float,
+        float> float_type;
+    return detail::eigen_array_map_t<TType>(
+        reinterpret_cast<float_type *>(v), rows,
+        static_cast<Eigen::Index>(cnt));
+}
+
+
+/// <summary>
+/// Views the positions of an array of OpenXR poses as an Eigen matrix
+/// without copying, which holds one position per column.
+/// </summary>
+/// <param name="poses">The poses to be viewed.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" />.
+/// </param>
+/// <returns>An Eigen map aliasing the positions of
+/// <paramref name="poses" />.</returns>
+template<class TPose>
+inline std::enable_if_t<std::is_same<std::remove_const_t<TPose>,
+    XrPosef>::value, eigen_pose_map<std::conditional_t<
+    std::is_const<TPose>::value, const Eigen::Matrix3Xf, Eigen::Matrix3Xf>>>
+as_eigen_positions(_In_reads_(cnt) TPose *poses,
+        _In_ const std::size_t cnt) noexcept {
+    static_assert(sizeof(XrPosef) == 7 * sizeof(float), "The OpenXR pose is "
+        "assumed to consist of seven floats.");
+    static_assert(offsetof(XrPosef, position) == 4 * sizeof(float), "The "
+        "position is assumed to follow the orientation.");
+    assert((poses != nullptr) || (cnt == 0));
+    typedef std::conditional_t<std::is_const<TPose>::value, const float,
+        float> float_type;
+    auto data = reinterpret_cast<float_type *>(poses) + 4;
+    return eigen_pose_map<std::conditional_t<std::is_const<TPose>::value,
+        const Eigen::Matrix3Xf, Eigen::Matrix3Xf>>(data, 3,
+        static_cast<Eigen::Index>(cnt));
+}
+
+
+/// <summary>
+/// Views the orientations of an array of OpenXR poses as an Eigen matrix
+/// without copying, which holds the coefficients of one quaternion per
+/// column.
+/// </summary>
+/// <param name="poses">The poses to be viewed.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" />.
+/// </param>
+/// <returns>An Eigen map aliasing the orientations of
+/// <paramref name="poses" />.</returns>
+template<class TPose>
+inline std::enable_if_t<std::is_same<std::remove_const_t<TPose>,
+    XrPosef>::value, eigen_pose_map<std::conditional_t<
+    std::is_const<TPose>::value, const Eigen::Matrix4Xf, Eigen::Matrix4Xf>>>
+as_eigen_orientations(_In_reads_(cnt) TPose *poses,
+        _In_ const std::size_t cnt) noexcept {
+    static_assert(sizeof(XrPosef) == 7 * sizeof(float), "The OpenXR pose is "
+        "assumed to consist of seven floats.");
+    static_assert(offsetof(XrPosef, orientation) == 0, "The orientation is "
+        "assumed to be the first member of the pose.");
+    assert((poses != nullptr) || (cnt == 0));
+    typedef std::conditional_t<std::is_const<TPose>::value, const float,
+        float> float_type;
+    auto data = reinterpret_cast<float_type *>(poses);
+    return eigen_pose_map<std::conditional_t<std::is_const<TPose>::value,
+        const Eigen::Matrix4Xf, Eigen::Matrix4Xf>>(data, 4,
+        static_cast<Eigen::Index>(cnt));
+}
+
+
+/// <summary>
+/// Converts an OpenXR pose into an Eigen isometry.
+/// </summary>
+/// <param name="p">The pose to be converted, whose orientation must be a
+/// unit quaternion.</param>
+/// <returns>The isometry representing the given pose.</returns>
+inline Eigen::Isometry3f to_eigen(_In_ const XrPosef& p) noexcept {
+    Eigen::Isometry3f retval;
+    retval.linear() = as_eigen(p.orientation).toRotationMatrix();
+    retval.translation() = as_eigen(p.position);
+    retval.makeAffine();
+    return retval;
+}
+
+
+/// <summary>
+/// Converts an Eigen isometry into an OpenXR pose.
+/// </summary>
+/// <param name="i">The isometry to be converted.</param>
+/// <returns>The pose representing the given isometry.</returns>
+inline XrPosef from_eigen(_In_ const Eigen::Isometry3f& i) noexcept {
+    XrPosef retval;
+    as_eigen(retval.orientation) = Eigen::Quaternionf(i.linear());
+    as_eigen(retval.position) = i.translation();
+    return retval;
+}
+
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Views a span of OpenXR vectors or quaternions as an Eigen matrix without
+/// copying, which holds one element per column.
+/// </summary>
+/// <typeparam name="TType">The OpenXR type, which may be <c>const</c>.
+/// </typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="s">The span to be viewed.</param>
+/// <returns>An Eigen map aliasing <paramref name="s" />.</returns>
+template<class TType, std::size_t Extent>
+inline auto as_eigen(_In_ const std::span<TType, Extent> s) noexcept
+        -> decltype(as_eigen(s.data(), s.size())) {
+    return as_eigen(s.data(), s.size());
+}
+
+/// <summary>
+/// Views the positions of a span of OpenXR poses as an Eigen matrix without
+/// copying, which holds one position per column.
+/// </summary>
+/// <typeparam name="TPose">The pose type, which may be <c>const</c>.
+/// </typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="poses">The poses to be viewed.</param>
+/// <returns>An Eigen map aliasing the positions of
+/// <paramref name="poses" />.</returns>
+template<class TPose, std::size_t Extent>
+inline auto as_eigen_positions(
+        _In_ const std::span<TPose, Extent> poses) noexcept
+        -> decltype(as_eigen_positions(poses.data(), poses.size())) {
+    return as_eigen_positions(poses.data(), poses.size());
+}
+
+/// <summary>
+/// Views the orientations of a span of OpenXR poses as an Eigen matrix
+/// without copying, which holds the coefficients of one quaternion per
+/// column.
+/// </summary>
+/// <typeparam name="TPose">The pose type, which may be <c>const</c>.
+/// </typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="poses">The poses to be viewed.</param>
+/// <returns>An Eigen map aliasing the orientations of
+/// <paramref name="poses" />.</returns>
+template<class TPose, std::size_t Extent>
+inline auto as_eigen_orientations(
+        _In_ const std::span<TPose, Extent> poses) noexcept
+        -> decltype(as_eigen_orientations(poses.data(), poses.size())) {
+    return as_eigen_orientations(poses.data(), poses.size());
+}
+#endif /* defined(__cpp_lib_span) */
+
+XRTL_NAMESPACE_END
+
+#endif /* defined(XRTL_WITH_EIGEN) */
+
+#endif /* !defined(_XRTL_EIGEN_H) */
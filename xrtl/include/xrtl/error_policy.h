@@ -0,0 +1,351 @@
+﻿// <copyright file="error_policy.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_ERROR_POLICY_H)
+#define _XRTL_ERROR_POLICY_H
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/xr_error_category.h"
+#include "xrtl/xr_result_names.h"
+
+
+/// <summary>
+/// Indicates whether the library may throw exceptions.
+/// </summary>
+/// <remarks>
+/// The value is derived from the compiler settings unless it has been defined
+/// by the application before including any of the headers of the library.
+/// If exceptions are disabled, <see cref="xrtl::throw_error_policy" /> is not
+/// available and the <c>THROW_*</c> macros are routed to
+/// <see cref="xrtl::default_error_policy" />.
+/// </remarks>
+#if !defined(XRTL_HAS_EXCEPTIONS)
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#define XRTL_HAS_EXCEPTIONS (1)
+#else /* defined(__cpp_exceptions) || defined(_CPPUNWIND) */
+#define XRTL_HAS_EXCEPTIONS (0)
+#endif /* defined(__cpp_exceptions) || defined(_CPPUNWIND) */
+#endif /* !defined(XRTL_HAS_EXCEPTIONS) */
+
+
+XRTL_NAMESPACE_BEGIN
+
+template<class TValue> class expected;
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Answer the given error message as C string.
+/// </summary>
+/// <param name="message">The message, which may be <c>nullptr</c>.</param>
+/// <returns><paramref name="message" />.</returns>
+inline _Ret_maybenull_z_ const char *message_c_str(
+        _In_opt_z_ const char *message) noexcept {
+    return message;
+}
+
+/// <summary>
+/// Answer the given error message as C string.
+/// </summary>
+/// <param name="message">The message.</param>
+/// <returns>The content of <paramref name="message" />, which remains valid
+/// as long as <paramref name="message" /> is not modified.</returns>
+inline _Ret_z_ const char *message_c_str(
+        _In_ const std::string& message) noexcept {
+    return message.c_str();
+}
+
+/// <summary>
+/// Writes the given failure to <c>stderr</c>.
+/// </summary>
+/// <param name="result">The result code of the operation that failed.
+/// </param>
+/// <param name="message">An optional description of the operation that
+/// failed.</param>
+XRTL_NOINLINE XRTL_COLD inline void log_error(_In_ const XrResult result,
+        _In_opt_z_ const char *message) noexcept {
+    auto name = xr_result_name(result);
+    std::fprintf(stderr, "OpenXR error %s (%d): %s\n",
+        (name != nullptr) ? name : "unknown",
+        static_cast<int>(result),
+        (message != nullptr) ? message : "");
+}
+
+/// <summary>
+/// Writes the given invalid argument message to <c>stderr</c>.
+/// </summary>
+/// <param name="message">A description of the invalid argument.</param>
+XRTL_NOINLINE XRTL_COLD inline void log_invalid_argument(
+        _In_opt_z_ const char *message) noexcept {
+    std::fprintf(stderr, "Invalid argument: %s\n",
+        (message != nullptr) ? message : "");
+}
+
+#if XRTL_HAS_EXCEPTIONS
+/// <summary>
+/// Throws a <see cref="std::system_error" /> representing the given
+/// <see cref="XrResult" />.
+/// </summary>
+/// <remarks>
+/// The function is never inlined and placed in the cold section, such that
+/// each check of an OpenXR result only compiles to a conditional call
+/// instead of the construction of the exception.
+/// </remarks>
+/// <param name="result">The result code used as error code. This is an
+/// <c>int</c> rather than an <see cref="XrResult" /> such that the macros
+/// accept everything <see cref="std::system_error" /> accepts.</param>
+/// <exception cref="std::system_error">Always.</exception>
+[[noreturn]] XRTL_NOINLINE XRTL_COLD inline void throw_xr_result(
+        _In_ const int result) {
+    throw std::system_error(result, XRTL_NAMESPACE::xr_category());
+}
+
+/// <summary>
+/// Throws a <see cref="std::system_error" /> representing the given
+/// <see cref="XrResult" /> with a custom message.
+/// </summary>
+/// <param name="result">The result code used as error code.</param>
+/// <param name="message">A custom error message.</param>
+/// <exception cref="std::system_error">Always.</exception>
+[[noreturn]] XRTL_NOINLINE XRTL_COLD inline void throw_xr_result(
+        _In_ const int result,
+        _In_z_ const char *message) {
+    throw std::system_error(result, XRTL_NAMESPACE::xr_category(), message);
+}
+
+/// <summary>
+/// Throws a <see cref="std::system_error" /> representing the given
+/// <see cref="XrResult" /> with a custom message.
+/// </summary>
+/// <param name="result">The result code used as error code.</param>
+/// <param name="message">A custom error message.</param>
+/// <exception cref="std::system_error">Always.</exception>
+[[noreturn]] XRTL_NOINLINE XRTL_COLD inline void throw_xr_result(
+        _In_ const int result,
+        _In_ const std::string& message) {
+    throw std::system_error(result, XRTL_NAMESPACE::xr_category(), message);
+}
+
+/// <summary>
+/// Throws a <see cref="std::invalid_argument" /> with the given message.
+/// </summary>
+/// <param name="message">A description of the problem.</param>
+/// <exception cref="std::invalid_argument">Always.</exception>
+[[noreturn]] XRTL_NOINLINE XRTL_COLD inline void throw_invalid_argument(
+        _In_z_ const char *message) {
+    throw std::invalid_argument(message);
+}
+#endif /* XRTL_HAS_EXCEPTIONS */
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+#if XRTL_HAS_EXCEPTIONS
+/// <summary>
+/// An error policy that reports OpenXR failures by throwing a
+/// <see cref="std::system_error" /> and invalid arguments by throwing a
+/// <see cref="std::invalid_argument" />.
+/// </summary>
+/// <remarks>
+/// This is the default policy if exceptions are enabled.
+/// </remarks>
+struct throw_error_policy final {
+
+    /// <summary>
+    /// The type returned by operations yielding <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = TValue;
+
+    /// <summary>
+    /// Indicates that the policy does not return from a failure.
+    /// </summary>
+    static constexpr bool continues = false;
+
+    /// <summary>
+    /// Handles the failure of an OpenXR call.
+    /// </summary>
+    /// <param name="result">The result code of the failed call.</param>
+    /// <param name="message">An optional custom error message.</param>
+    /// <exception cref="std::system_error">Always.</exception>
+    [[noreturn]] static inline void on_failure(_In_ const XrResult result,
+            _In_opt_z_ const char *message) {
+        if (message != nullptr) {
+            detail::throw_xr_result(result, message);
+        } else {
+            detail::throw_xr_result(result);
+        }
+    }
+
+    /// <summary>
+    /// Handles an invalid argument passed to the library.
+    /// </summary>
+    /// <param name="message">A description of the problem.</param>
+    /// <exception cref="std::invalid_argument">Always.</exception>
+    [[noreturn]] static inline void on_invalid_argument(
+            _In_z_ const char *message) {
+        detail::throw_invalid_argument(message);
+    }
+};
+#endif /* XRTL_HAS_EXCEPTIONS */
+
+
+/// <summary>
+/// An error policy that reports failures by returning their result code in an
+/// <see cref="expected" />.
+/// </summary>
+/// <remarks>
+/// Functions that cannot return an <see cref="expected" />, most notably
+/// constructors, leave their object in an empty state instead.
+/// </remarks>
+struct return_error_policy final {
+
+    /// <summary>
+    /// The type returned by operations yielding <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = expected<TValue>;
+
+    /// <summary>
+    /// Indicates that the policy returns from a failure.
+    /// </summary>
+    static constexpr bool continues = true;
+
+    /// <summary>
+    /// Handles the failure of an OpenXR call, which is a no-op.
+    /// </summary>
+    static inline void on_failure(_In_ const XrResult,
+        _In_opt_z_ const char *) noexcept { }
+
+    /// <summary>
+    /// Handles an invalid argument passed to the library, which is a no-op.
+    /// </summary>
+    static inline void on_invalid_argument(_In_z_ const char *) noexcept { }
+};
+
+
+/// <summary>
+/// An error policy that writes failures to <c>stderr</c> and continues.
+/// </summary>
+/// <remarks>
+/// Functions returning a value yield a value-initialised object, for instance
+/// <c>XR_NULL_PATH</c>, if they fail.
+/// </remarks>
+struct log_error_policy final {
+
+    /// <summary>
+    /// The type returned by operations yielding <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = TValue;
+
+    /// <summary>
+    /// Indicates that the policy returns from a failure.
+    /// </summary>
+    static constexpr bool continues = true;
+
+    /// <summary>
+    /// Handles the failure of an OpenXR call by logging it.
+    /// </summary>
+    /// <param name="result">The result code of the failed call.</param>
+    /// <param name="message">An optional custom error message.</param>
+    static inline void on_failure(_In_ const XrResult result,
+            _In_opt_z_ const char *message) noexcept {
+        detail::log_error(result, message);
+    }
+
+    /// <summary>
+    /// Handles an invalid argument passed to the library by logging it.
+    /// </summary>
+    /// <param name="message">A description of the problem.</param>
+    static inline void on_invalid_argument(
+            _In_z_ const char *message) noexcept {
+        detail::log_invalid_argument(message);
+    }
+};
+
+
+/// <summary>
+/// An error policy that writes failures to <c>stderr</c> and aborts the
+/// process.
+/// </summary>
+/// <remarks>
+/// This is the default policy if exceptions are disabled.
+/// </remarks>
+struct abort_error_policy final {
+
+    /// <summary>
+    /// The type returned by operations yielding <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = TValue;
+
+    /// <summary>
+    /// Indicates that the policy does not return from a failure.
+    /// </summary>
+    static constexpr bool continues = false;
+
+    /// <summary>
+    /// Handles the failure of an OpenXR call by logging it and aborting.
+    /// </summary>
+    /// <param name="result">The result code of the failed call.</param>
+    /// <param name="message">An optional custom error message.</param>
+    [[noreturn]] static inline void on_failure(_In_ const XrResult result,
+            _In_opt_z_ const char *message) noexcept {
+        detail::log_error(result, message);
+        std::abort();
+    }
+
+    /// <summary>
+    /// Handles an invalid argument passed to the library by logging it and
+    /// aborting.
+    /// </summary>
+    /// <param name="message">A description of the problem.</param>
+    [[noreturn]] static inline void on_invalid_argument(
+            _In_z_ const char *message) noexcept {
+        detail::log_invalid_argument(message);
+        std::abort();
+    }
+};
+
+
+#if defined(XRTL_DEFAULT_ERROR_POLICY)
+/// <summary>
+/// The error policy used by all functions that do not have an explicit error
+/// policy, which has been configured by the application.
+/// </summary>
+typedef XRTL_DEFAULT_ERROR_POLICY default_error_policy;
+
+#elif XRTL_HAS_EXCEPTIONS
+/// <summary>
+/// The error policy used by all functions that do not have an explicit error
+/// policy, which is <see cref="throw_error_policy" /> if exceptions are
+/// enabled.
+/// </summary>
+typedef throw_error_policy default_error_policy;
+
+#else /* defined(XRTL_DEFAULT_ERROR_POLICY) */
+/// <summary>
+/// The error policy used by all functions that do not have an explicit error
+/// policy, which is <see cref="abort_error_policy" /> if exceptions are
+/// disabled.
+/// </summary>
+typedef abort_error_policy default_error_policy;
+#endif /* defined(XRTL_DEFAULT_ERROR_POLICY) */
+
+XRTL_NAMESPACE_END
+
+#endif /* !defined(_XRTL_ERROR_POLICY_H) */
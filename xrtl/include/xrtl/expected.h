@@ -0,0 +1,385 @@
+﻿// <copyright file="expected.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_EXPECTED_H)
+#define _XRTL_EXPECTED_H
+#pragma once
+
+#include <cassert>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/result.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The result of an operation that either yields a value or fails with an
+/// <see cref="XrResult" />, which can be checked without throwing an
+/// exception.
+/// </summary>
+/// <remarks>
+/// Unlike <c>std::expected</c>, the object always holds an
+/// <see cref="XrResult" />, because OpenXR uses success codes like
+/// <c>XR_SESSION_NOT_FOCUSED</c> or <c>XR_FRAME_DISCARDED</c> to report
+/// information that the application must not ignore. The value is present if
+/// and only if the result represents success.
+/// </remarks>
+/// <typeparam name="TValue">The type of the value returned on success.
+/// </typeparam>
+template<class TValue> class expected final {
+
+public:
+
+    /// <summary>
+    /// The type of the value returned on success.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance representing a failure.
+    /// </summary>
+    /// <param name="result">The result code, which must represent a failure.
+    /// </param>
+    inline expected(_In_ const XrResult result) noexcept : _result(result) {
+        assert(XR_FAILED(result));
+    }
+
+    /// <summary>
+    /// Initialises a new instance representing success.
+    /// </summary>
+    /// <param name="value">The value of the operation.</param>
+    /// <param name="result">The result code, which must represent success.
+    /// </param>
+    inline expected(_In_ const value_type& value,
+            _In_ const XrResult result = XR_SUCCESS)
+            : _result(result), _value(value) {
+        assert(XR_SUCCEEDED(result));
+    }
+
+    /// <summary>
+    /// Initialises a new instance representing success.
+    /// </summary>
+    /// <param name="value">The value of the operation.</param>
+    /// <param name="result">The result code, which must represent success.
+    /// </param>
+    inline expected(_Inout_ value_type&& value,
+            _In_ const XrResult result = XR_SUCCESS)
+            : _result(result), _value(std::move(value)) {
+        assert(XR_SUCCEEDED(result));
+    }
+
+    /// <summary>
+    /// Answer whether the operation succeeded and the object holds a value.
+    /// </summary>
+    /// <returns><c>true</c> if there is a value, <c>false</c> otherwise.
+    /// </returns>
+    inline bool has_value(void) const noexcept {
+        return this->_value.has_value();
+    }
+
+    /// <summary>
+    /// Gets the result code of the operation, which might be a success code
+    /// other than <c>XR_SUCCESS</c>.
+    /// </summary>
+    /// <returns>The result code.</returns>
+    inline XrResult result(void) const noexcept {
+        return this->_result;
+    }
+
+    /// <summary>
+    /// Gets the value.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    /// <exception cref="std::system_error">If the operation failed.
+    /// </exception>
+    inline value_type& value(void) & {
+        THROW_XR_RESULT_IF(this->_result, !this->has_value());
+        return *this->_value;
+    }
+
+    /// <summary>
+    /// Gets the value.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    /// <exception cref="std::system_error">If the operation failed.
+    /// </exception>
+    inline const value_type& value(void) const & {
+        THROW_XR_RESULT_IF(this->_result, !this->has_value());
+        return *this->_value;
+    }
+
+    /// <summary>
+    /// Moves the value out of the object.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    /// <exception cref="std::system_error">If the operation failed.
+    /// </exception>
+    inline value_type&& value(void) && {
+        THROW_XR_RESULT_IF(this->_result, !this->has_value());
+        return std::move(*this->_value);
+    }
+
+    /// <summary>
+    /// Gets the value or the given fallback if the operation failed.
+    /// </summary>
+    /// <param name="fallback">The value to be returned in case of a failure.
+    /// </param>
+    /// <returns>The value of the operation or <paramref name="fallback" />.
+    /// </returns>
+    template<class TFallback>
+    inline value_type value_or(_In_ TFallback&& fallback) const & {
+        return this->_value.value_or(std::forward<TFallback>(fallback));
+    }
+
+    /// <summary>
+    /// Answer whether the operation succeeded and the object holds a value.
+    /// </summary>
+    /// <returns><c>true</c> if there is a value, <c>false</c> otherwise.
+    /// </returns>
+    inline explicit operator bool(void) const noexcept {
+        return this->has_value();
+    }
+
+    /// <summary>
+    /// Gets the value, which must exist.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    inline value_type& operator *(void) & noexcept {
+        assert(this->has_value());
+        return *this->_value;
+    }
+
+    /// <summary>
+    /// Gets the value, which must exist.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    inline const value_type& operator *(void) const & noexcept {
+        assert(this->has_value());
+        return *this->_value;
+    }
+
+    /// <summary>
+    /// Moves the value, which must exist, out of the object.
+    /// </summary>
+    /// <returns>The value of the operation.</returns>
+    inline value_type&& operator *(void) && noexcept {
+        assert(this->has_value());
+        return std::move(*this->_value);
+    }
+
+    /// <summary>
+    /// Accesses the value, which must exist.
+    /// </summary>
+    /// <returns>A pointer to the value.</returns>
+    inline value_type *operator ->(void) noexcept {
+        assert(this->has_value());
+        return std::addressof(*this->_value);
+    }
+
+    /// <summary>
+    /// Accesses the value, which must exist.
+    /// </summary>
+    /// <returns>A pointer to the value.</returns>
+    inline const value_type *operator ->(void) const noexcept {
+        assert(this->has_value());
+        return std::addressof(*this->_value);
+    }
+
+private:
+
+    XrResult _result;
+    std::optional<value_type> _value;
+};
+
+
+/// <summary>
+/// Specialisation for operations that do not yield a value, which only
+/// preserves the result code.
+/// </summary>
+template<> class expected<void> final {
+
+public:
+
+    /// <summary>
+    /// The type of the value returned on success.
+    /// </summary>
+    typedef void value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="result">The result code, which may represent success or
+    /// failure.</param>
+    inline expected(_In_ const XrResult result = XR_SUCCESS) noexcept
+        : _result(result) { }
+
+    /// <summary>
+    /// Answer whether the operation succeeded.
+    /// </summary>
+    /// <returns><c>true</c> if the result code represents success,
+    /// <c>false</c> otherwise.</returns>
+    inline bool has_value(void) const noexcept {
+        return XR_SUCCEEDED(this->_result);
+    }
+
+    /// <summary>
+    /// Gets the result code of the operation, which might be a success code
+    /// other than <c>XR_SUCCESS</c>.
+    /// </summary>
+    /// <returns>The result code.</returns>
+    inline XrResult result(void) const noexcept {
+        return this->_result;
+    }
+
+    /// <summary>
+    /// Checks that the operation succeeded.
+    /// </summary>
+    /// <exception cref="std::system_error">If the operation failed.
+    /// </exception>
+    inline void value(void) const {
+        THROW_XR_RESULT_IF(this->_result, !this->has_value());
+    }
+
+    /// <summary>
+    /// Answer whether the operation succeeded.
+    /// </summary>
+    /// <returns><c>true</c> if the result code represents success,
+    /// <c>false</c> otherwise.</returns>
+    inline explicit operator bool(void) const noexcept {
+        return this->has_value();
+    }
+
+private:
+
+    XrResult _result;
+};
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Extracts the result code from an <see cref="XrResult" /> for use in
+/// <see cref="XRTL_TRY" />.
+/// </summary>
+inline XrResult to_xr_result(_In_ const XrResult result) noexcept {
+    return result;
+}
+
+/// <summary>
+/// Extracts the result code from an <see cref="expected" /> for use in
+/// <see cref="XRTL_TRY" />.
+/// </summary>
+template<class TValue>
+inline XrResult to_xr_result(_In_ const expected<TValue>& result) noexcept {
+    return result.result();
+}
+
+/// <summary>
+/// Creates the result of a failed operation according to the given error
+/// policy after the policy has been notified about the failure.
+/// </summary>
+/// <typeparam name="TErrorPolicy">The error policy determining the return
+/// type.</typeparam>
+/// <typeparam name="TValue">The type of the value that the operation would
+/// have returned on success.</typeparam>
+/// <param name="result">The result code of the failed operation.</param>
+/// <returns>An <see cref="expected" /> holding <paramref name="result" /> if
+/// the policy returns errors, a value-initialised object otherwise.</returns>
+template<class TErrorPolicy, class TValue>
+inline typename TErrorPolicy::template result_type<TValue> error_result(
+        _In_ const XrResult result) {
+    typedef typename TErrorPolicy::template result_type<TValue> result_type;
+    if constexpr (std::is_same<result_type, expected<TValue>>::value) {
+        return result;
+    } else {
+        (void) result;
+        return TValue();
+    }
+}
+
+/// <summary>
+/// Converts the given <see cref="expected" /> into the return type of the
+/// given error policy, notifying the policy if the operation failed.
+/// </summary>
+/// <typeparam name="TErrorPolicy">The error policy to be applied.
+/// </typeparam>
+/// <typeparam name="TValue">The type of the value returned by the operation.
+/// </typeparam>
+/// <param name="value">The outcome of the operation.</param>
+/// <param name="message">An optional description of the operation, which is
+/// passed to the policy on failure.</param>
+/// <returns>The outcome of the operation as required by the policy.
+/// </returns>
+template<class TErrorPolicy, class TValue>
+inline typename TErrorPolicy::template result_type<TValue> apply_error_policy(
+        _Inout_ expected<TValue>&& value,
+        _In_opt_z_ const char *message = nullptr) {
+    typedef typename TErrorPolicy::template result_type<TValue> result_type;
+    if constexpr (std::is_same<result_type, expected<TValue>>::value) {
+        (void) message;
+        return std::move(value);
+    } else {
+        if (!value.has_value()) {
+            TErrorPolicy::on_failure(value.result(), message);
+            return error_result<TErrorPolicy, TValue>(value.result());
+        }
+        return std::move(*value);
+    }
+}
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+/// <summary>
+/// Evaluates the given expression yielding an <see cref="XrResult" /> or an
+/// <see cref="xrtl::expected" /> and returns its result code from the
+/// enclosing function if it represents a failure.
+/// </summary>
+/// <remarks>
+/// The enclosing function must return an <see cref="XrResult" /> or an
+/// <see cref="xrtl::expected" />. Success codes other than
+/// <c>XR_SUCCESS</c> are not propagated, so the expression should be
+/// evaluated directly if these are of interest.
+/// </remarks>
+/// <param name="e">An expression yielding a <see cref="XrResult" /> or an
+/// <see cref="xrtl::expected" />.</param>
+#define XRTL_TRY(e)\
+{ auto _xrtl_r = XRTL_DETAIL_NAMESPACE::to_xr_result(e);\
+if (XR_FAILED(_xrtl_r)) return _xrtl_r; }
+
+/// <summary>
+/// Evaluates the given expression yielding an <see cref="xrtl::expected" />
+/// and either returns its result code from the enclosing function if it
+/// represents a failure or moves its value into <paramref name="l" />.
+/// </summary>
+/// <remarks>
+/// <paramref name="l" /> can be a declaration like <c>auto p</c>, which will
+/// be visible in the rest of the enclosing scope.
+/// </remarks>
+/// <param name="l">The target for the value on success.</param>
+/// <param name="e">An expression yielding a <see cref="xrtl::expected" />.
+/// </param>
+#define XRTL_TRY_ASSIGN(l, e) _XRTL_TRY_ASSIGN(\
+XRTL_UNIQUE_NAME(_xrtl_try_), l, e)
+
+/// <summary>
+/// A helper for implementing <see cref="XRTL_TRY_ASSIGN" />.
+/// </summary>
+#define _XRTL_TRY_ASSIGN(t, l, e)\
+auto t = (e);\
+if (!t.has_value()) return t.result();\
+l = std::move(*t)
+
+#endif /* !defined(_XRTL_EXPECTED_H) */
@@ -0,0 +1,137 @@
+﻿// <copyright file="extension_functions.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_EXTENSION_FUNCTIONS_H)
+#define _XRTL_EXTENSION_FUNCTIONS_H
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cinttypes>
+#include <cstddef>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/dispatch_table.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Identifies the extension functions that can be resolved via
+/// <see cref="extension_functions" />.
+/// </summary>
+enum class xr_extension_function : std::uint32_t;
+
+
+/// <summary>
+/// Allows for deriving the <c>PFN_</c> type and the name of an OpenXR
+/// extension function from its <see cref="xr_extension_function" />.
+/// </summary>
+/// <remarks>
+/// There is no fallback implementation, i.e. using a function of an extension
+/// that is not available in the OpenXR headers will not compile.
+/// </remarks>
+/// <typeparam name="Function">The extension function described by this
+/// trait.</typeparam>
+template<xr_extension_function Function> struct xr_extension_function_traits;
+
+#include "xrtl/xr_extension_functions.inl"
+
+
+/// <summary>
+/// A lazily populated cache of the extension functions of a specific
+/// <see cref="XrInstance" />.
+/// </summary>
+/// <remarks>
+/// <para>Each function is resolved via <c>xrGetInstanceProcAddr</c> on first
+/// use and then served from the cache. Reading a resolved function is a single
+/// atomic load, so the cache can be shared between threads without locking.
+/// If two threads request the same unresolved function at the same time, both
+/// will resolve it, which is harmless as the result is the same.</para>
+/// <para>The cache is only valid as long as the instance it has been created
+/// for is alive.</para>
+/// </remarks>
+class extension_functions final {
+
+public:
+
+    /// <summary>
+    /// Initialises a new, empty instance, which cannot resolve any function.
+    /// </summary>
+    extension_functions(void) noexcept;
+
+    /// <summary>
+    /// Initialises a new instance for the given <paramref name="instance" />,
+    /// which will resolve the functions via the loader.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to resolve the functions
+    /// for.</param>
+    explicit extension_functions(_In_ const XrInstance instance) noexcept;
+
+    /// <summary>
+    /// Initialises a new instance for the given <paramref name="instance" />,
+    /// which will resolve the functions via the loader.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to resolve the functions
+    /// for.</param>
+    inline explicit extension_functions(
+        _In_ const unique_instance& instance) noexcept
+        : extension_functions(instance.get()) { }
+
+    /// <summary>
+    /// Initialises a new instance for the instance of the given
+    /// <paramref name="table" />, which will resolve the functions without
+    /// going through the loader.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance to
+    /// resolve the functions for.</param>
+    explicit extension_functions(_In_ const dispatch_table& table) noexcept;
+
+    extension_functions(const extension_functions&) = delete;
+
+    /// <summary>
+    /// Gets the specified extension function, resolving it if this has not
+    /// yet been done.
+    /// </summary>
+    /// <typeparam name="Function">The function to be retrieved.</typeparam>
+    /// <returns>The function pointer or <c>nullptr</c> if the function is not
+    /// available, e.g. because its extension has not been enabled.</returns>
+    template<xr_extension_function Function>
+    typename xr_extension_function_traits<Function>::type get(
+        void) const noexcept;
+
+    /// <summary>
+    /// Gets the instance the functions are resolved for.
+    /// </summary>
+    /// <returns>The OpenXR instance.</returns>
+    inline XrInstance instance(void) const noexcept {
+        return this->_instance;
+    }
+
+    extension_functions& operator =(const extension_functions&) = delete;
+
+private:
+
+    /// <summary>
+    /// Marks a function that has been resolved, but is not available.
+    /// </summary>
+    static inline void XRAPI_CALL unavailable(void) { }
+
+    PFN_xrVoidFunction resolve(_In_z_ const char *name) const noexcept;
+
+    mutable std::array<std::atomic<PFN_xrVoidFunction>,
+        xr_extension_function_count> _functions;
+    PFN_xrGetInstanceProcAddr _get_instance_proc_addr;
+    XrInstance _instance;
+};
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/extension_functions.inl"
+
+#endif /* !defined(_XRTL_EXTENSION_FUNCTIONS_H) */
@@ -0,0 +1,83 @@
+﻿// <copyright file="extension_functions.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::extension_functions::extension_functions
+ */
+inline XRTL_NAMESPACE::extension_functions::extension_functions(
+        void) noexcept
+    : _get_instance_proc_addr(nullptr), _instance(XR_NULL_HANDLE) {
+    for (auto& f : this->_functions) {
+        f.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::extension_functions::extension_functions
+ */
+inline XRTL_NAMESPACE::extension_functions::extension_functions(
+        _In_ const XrInstance instance) noexcept : extension_functions() {
+    this->_get_instance_proc_addr = ::xrGetInstanceProcAddr;
+    this->_instance = instance;
+}
+
+
+/*
+ * XRTL_NAMESPACE::extension_functions::extension_functions
+ */
+inline XRTL_NAMESPACE::extension_functions::extension_functions(
+        _In_ const dispatch_table& table) noexcept : extension_functions() {
+    this->_get_instance_proc_addr = table.xrGetInstanceProcAddr;
+    this->_instance = table.instance();
+}
+
+
+/*
+ * XRTL_NAMESPACE::extension_functions::get
+ */
+template<XRTL_NAMESPACE::xr_extension_function Function>
+typename XRTL_NAMESPACE::xr_extension_function_traits<Function>::type
+XRTL_NAMESPACE::extension_functions::get(void) const noexcept {
+    typedef xr_extension_function_traits<Function> traits_type;
+    constexpr auto index = static_cast<std::size_t>(Function);
+    static_assert(index < xr_extension_function_count, "The extension "
+        "function is out of range.");
+
+    auto& slot = this->_functions[index];
+    auto retval = slot.load(std::memory_order_acquire);
+
+    if (retval == nullptr) {
+        retval = this->resolve(traits_type::name());
+        slot.store(retval, std::memory_order_release);
+    }
+
+    return (retval != &extension_functions::unavailable)
+        ? reinterpret_cast<typename traits_type::type>(retval)
+        : nullptr;
+}
+
+
+/*
+ * XRTL_NAMESPACE::extension_functions::resolve
+ */
+inline PFN_xrVoidFunction XRTL_NAMESPACE::extension_functions::resolve(
+        _In_z_ const char *name) const noexcept {
+    assert(name != nullptr);
+    PFN_xrVoidFunction retval = nullptr;
+
+    if ((this->_get_instance_proc_addr != nullptr)
+            && (this->_instance != XR_NULL_HANDLE)) {
+        auto status = this->_get_instance_proc_addr(this->_instance, name,
+            &retval);
+        if (XR_FAILED(status)) {
+            retval = nullptr;
+        }
+    }
+
+    return (retval != nullptr) ? retval : &extension_functions::unavailable;
+}
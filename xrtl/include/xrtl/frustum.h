@@ -0,0 +1,194 @@
+﻿// <copyright file="frustum.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_FRUSTUM_H)
+#define _XRTL_FRUSTUM_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/matrix.h"
+#include "xrtl/pose.h"
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Computes the dot product of two vectors.
+/// </summary>
+inline float frustum_dot(_In_ const XrVector3f& lhs,
+        _In_ const XrVector3f& rhs) noexcept {
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+}
+
+/// <summary>
+/// Computes the rays through the corners of the image rectangle of the given
+/// view, which point to the corners at a distance of one.
+/// </summary>
+inline void frustum_corner_rays(_In_ const XrView& view,
+        _Out_writes_(4) XrVector3f *rays) noexcept {
+    const float x[] = { std::tan(view.fov.angleLeft),
+        std::tan(view.fov.angleRight) };
+    const float y[] = { std::tan(view.fov.angleDown),
+        std::tan(view.fov.angleUp) };
+    for (std::size_t i = 0; i < 4; ++i) {
+        rays[i] = rotate(view.pose.orientation,
+            XrVector3f { x[i & 1], y[i >> 1], -1.0f });
+    }
+}
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A view frustum given by its apex, orientation and field of view as well
+/// as by its six bounding planes.
+/// </summary>
+/// <remarks>
+/// <para>The pose, the field of view and the clipping planes can be passed to
+/// <see cref="make_matrix" /> and the view matrix functions to render or
+/// cull in a single pass, whereas the planes allow for testing geometry
+/// without any matrix.</para>
+/// <para>The planes are in the space the frustum was created in. The normal
+/// in <c>x</c>, <c>y</c> and <c>z</c> points inwards and <c>w</c> holds the
+/// signed distance of the origin, ie a point <c>p</c> is inside the plane if
+/// <c>dot(plane.xyz, p) + plane.w</c> is not negative. The order of the
+/// planes is left, right, bottom, top, near and far. If the far plane is
+/// infinitely distant, its normal is zero and its distance is one, so that
+/// every point is inside it.</para>
+/// </remarks>
+struct frustum {
+    /// <summary>
+    /// The apex of the frustum and its orientation, which looks along the
+    /// negative z-axis like an <see cref="XrView" />.
+    /// </summary>
+    XrPosef pose;
+
+    /// <summary>
+    /// The field of view of the frustum.
+    /// </summary>
+    XrFovf fov;
+
+    /// <summary>
+    /// The distance of the near plane from the apex.
+    /// </summary>
+    float near_plane;
+
+    /// <summary>
+    /// The distance of the far plane from the apex, which may be infinity.
+    /// </summary>
+    float far_plane;
+
+    /// <summary>
+    /// The planes bounding the frustum.
+    /// </summary>
+    XrVector4f planes[6];
+};
+
+
+/// <summary>
+/// Answer whether the given point is inside the frustum.
+/// </summary>
+/// <param name="volume">The frustum to test against.</param>
+/// <param name="point">The point to be tested, which must be in the same
+/// space as the frustum.</param>
+/// <returns><c>true</c> if the point is inside or on the boundary of the
+/// frustum, <c>false</c> otherwise.</returns>
+bool contains(_In_ const frustum& volume,
+    _In_ const XrVector3f& point) noexcept;
+
+/// <summary>
+/// Answer whether the given sphere is at least partially inside the frustum.
+/// </summary>
+/// <remarks>
+/// The test is conservative, ie it may report spheres close to the corners
+/// of the frustum as intersecting although they are not, which is the
+/// expected behaviour for culling.
+/// </remarks>
+/// <param name="volume">The frustum to test against.</param>
+/// <param name="centre">The centre of the sphere, which must be in the same
+/// space as the frustum.</param>
+/// <param name="radius">The radius of the sphere.</param>
+/// <returns><c>false</c> if the sphere is certainly outside the frustum,
+/// <c>true</c> otherwise.</returns>
+bool intersects(_In_ const frustum& volume,
+    _In_ const XrVector3f& centre,
+    _In_ const float radius) noexcept;
+
+/// <summary>
+/// Creates a single frustum that encloses the frusta of all given views,
+/// which can be used to cull once for single-pass stereo or quad-view
+/// rendering.
+/// </summary>
+/// <remarks>
+/// <para>The orientation of the combined frustum is the normalised average
+/// of the orientations of the views. Its field of view is the union of the
+/// fields of view of the views in this orientation, and its apex is moved
+/// backwards from the centroid of the view positions until all views are
+/// inside the side planes. The near and far planes are chosen such that they
+/// enclose the near and far planes of all views, so every point visible in
+/// any of the views is inside the combined frustum.</para>
+/// <para>The views may be rotated against each other as for canted displays,
+/// but the union of their fields of view must be smaller than 180 degrees in
+/// the average orientation.</para>
+/// </remarks>
+/// <param name="views">The views located by <c>xrLocateViews</c>.</param>
+/// <param name="cnt">The number of elements in <paramref name="views" />,
+/// which must be at least one.</param>
+/// <param name="near_plane">The distance of the near plane of the views,
+/// which must not be negative.</param>
+/// <param name="far_plane">The distance of the far plane of the views,
+/// which must be larger than the near plane and may be infinity.</param>
+/// <returns>The combined frustum in the space the views were located in. If
+/// the input is invalid and the <see cref="default_error_policy" />
+/// continues, a value-initialised frustum is returned.</returns>
+/// <exception cref="std::invalid_argument">If there are no views, if the
+/// field of view of a view or the clipping planes are invalid or if the
+/// views cannot be enclosed by a single frustum and the
+/// <see cref="default_error_policy" /> throws.</exception>
+frustum make_combined_frustum(_In_reads_(cnt) const XrView *views,
+    _In_ const std::size_t cnt,
+    _In_ const float near_plane,
+    _In_ const float far_plane);
+
+/// <summary>
+/// Creates a single frustum that encloses the frusta of all given views.
+/// </summary>
+/// <typeparam name="Views">The number of views.</typeparam>
+/// <param name="views">The views located by <c>xrLocateViews</c>.</param>
+/// <param name="near_plane">The distance of the near plane of the views,
+/// which must not be negative.</param>
+/// <param name="far_plane">The distance of the far plane of the views,
+/// which must be larger than the near plane and may be infinity.</param>
+/// <returns>The combined frustum in the space the views were located in.
+/// </returns>
+/// <exception cref="std::invalid_argument">If the field of view of a view or
+/// the clipping planes are invalid or if the views cannot be enclosed by a
+/// single frustum and the <see cref="default_error_policy" /> throws.
+/// </exception>
+template<std::size_t Views>
+inline frustum make_combined_frustum(_In_ const XrView (&views)[Views],
+        _In_ const float near_plane,
+        _In_ const float far_plane) {
+    return make_combined_frustum(views, Views, near_plane, far_plane);
+}
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/frustum.inl"
+
+#endif /* !defined(_XRTL_FRUSTUM_H) */
@@ -0,0 +1,265 @@
+﻿// <copyright file="frustum.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::contains
+ */
+inline bool XRTL_NAMESPACE::contains(_In_ const frustum& volume,
+        _In_ const XrVector3f& point) noexcept {
+    return intersects(volume, point, 0.0f);
+}
+
+
+/*
+ * XRTL_NAMESPACE::intersects
+ */
+inline bool XRTL_NAMESPACE::intersects(_In_ const frustum& volume,
+        _In_ const XrVector3f& centre,
+        _In_ const float radius) noexcept {
+    for (auto& p : volume.planes) {
+        const XrVector3f normal { p.x, p.y, p.z };
+        if (detail::frustum_dot(normal, centre) + p.w < -radius) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * XRTL_NAMESPACE::make_combined_frustum
+ */
+inline XRTL_NAMESPACE::frustum XRTL_NAMESPACE::make_combined_frustum(
+        _In_reads_(cnt) const XrView *views,
+        _In_ const std::size_t cnt,
+        _In_ const float near_plane,
+        _In_ const float far_plane) {
+    using namespace detail;
+    frustum retval { };
+
+    if (cnt < 1) {
+        default_error_policy::on_invalid_argument("At least one view is "
+            "required to create a frustum.");
+        return retval;
+    }
+
+    assert(views != nullptr);
+    for (std::size_t i = 0; i < cnt; ++i) {
+        auto error = validate_projection(views[i].fov, near_plane, far_plane);
+        if (error != nullptr) {
+            default_error_policy::on_invalid_argument(error);
+            return retval;
+        }
+    }
+
+    if (!(far_plane > near_plane)) {
+        default_error_policy::on_invalid_argument("The far plane must be "
+            "behind the near plane.");
+        return retval;
+    }
+
+    constexpr auto epsilon = 16.0f * std::numeric_limits<float>::epsilon();
+    const auto infinite = std::isinf(far_plane);
+
+    // Average the orientations and the positions of all views. As q and -q
+    // represent the same rotation, the quaternions are flipped into the
+    // hemisphere of the first one before they are summed up.
+    XrQuaternionf q { 0.0f, 0.0f, 0.0f, 0.0f };
+    XrVector3f centre { 0.0f, 0.0f, 0.0f };
+    for (std::size_t i = 0; i < cnt; ++i) {
+        const auto& r = views[0].pose.orientation;
+        const auto& o = views[i].pose.orientation;
+        const auto s = (o.x * r.x + o.y * r.y + o.z * r.z + o.w * r.w < 0.0f)
+            ? -1.0f
+            : 1.0f;
+        q.x += s * o.x;
+        q.y += s * o.y;
+        q.z += s * o.z;
+        q.w += s * o.w;
+        centre.x += views[i].pose.position.x;
+        centre.y += views[i].pose.position.y;
+        centre.z += views[i].pose.position.z;
+    }
+
+    {
+        const auto l = 1.0f / std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z
+            + q.w * q.w);
+        q.x *= l;
+        q.y *= l;
+        q.z *= l;
+        q.w *= l;
+
+        const auto n = 1.0f / static_cast<float>(cnt);
+        centre.x *= n;
+        centre.y *= n;
+        centre.z *= n;
+    }
+
+    const auto inverse = invert(q);
+
+    // Find the tangents enclosing the corner rays of all views in the local
+    // space of the combined frustum. The image rectangle of a view remains a
+    // quadrilateral when it is projected onto the image plane of the combined
+    // frustum, so its corners suffice.
+    auto left = std::numeric_limits<float>::max();
+    auto right = std::numeric_limits<float>::lowest();
+    auto bottom = std::numeric_limits<float>::max();
+    auto top = std::numeric_limits<float>::lowest();
+
+    for (std::size_t i = 0; i < cnt; ++i) {
+        XrVector3f rays[4];
+        frustum_corner_rays(views[i], rays);
+
+        for (auto& r : rays) {
+            const auto d = rotate(inverse, r);
+            if (!(d.z < 0.0f)) {
+                default_error_policy::on_invalid_argument("The views cannot "
+                    "be enclosed by a single frustum.");
+                return retval;
+            }
+
+            left = (std::min)(left, d.x / -d.z);
+            right = (std::max)(right, d.x / -d.z);
+            bottom = (std::min)(bottom, d.y / -d.z);
+            top = (std::max)(top, d.y / -d.z);
+        }
+    }
+
+    // Widen the field of view slightly such that points on its boundary,
+    // which may have been computed differently by the caller, cannot be
+    // rounded to the outside.
+    left -= epsilon * (1.0f + std::abs(left));
+    right += epsilon * (1.0f + std::abs(right));
+    bottom -= epsilon * (1.0f + std::abs(bottom));
+    top += epsilon * (1.0f + std::abs(top));
+
+    // The inward normals of the side planes through the apex in local space.
+    XrVector3f normals[] = {
+        { 1.0f, 0.0f, left },
+        { -1.0f, 0.0f, -right },
+        { 0.0f, 1.0f, bottom },
+        { 0.0f, -1.0f, -top }
+    };
+    for (auto& n : normals) {
+        const auto l = 1.0f / std::sqrt(frustum_dot(n, n));
+        n.x *= l;
+        n.y *= l;
+        n.z *= l;
+    }
+
+    // Move the apex backwards along the central ray until every view
+    // position is inside all side planes. The rays of a view are within the
+    // tangents of the combined frustum, so they cannot leave it from there.
+    // The central ray is inside all side planes, so the denominator is
+    // positive.
+    const XrVector3f axis { 0.5f * (left + right), 0.5f * (bottom + top),
+        -1.0f };
+    auto offset = 0.0f;
+    for (std::size_t i = 0; i < cnt; ++i) {
+        const auto& p = views[i].pose.position;
+        const auto v = rotate(inverse, XrVector3f { p.x - centre.x,
+            p.y - centre.y, p.z - centre.z });
+        for (auto& n : normals) {
+            offset = (std::max)(offset, -frustum_dot(n, v)
+                / frustum_dot(n, axis));
+        }
+    }
+
+    const auto shift = rotate(q, axis);
+    const XrVector3f apex { centre.x - offset * shift.x,
+        centre.y - offset * shift.y, centre.z - offset * shift.z };
+    const auto forward = rotate(q, XrVector3f { 0.0f, 0.0f, -1.0f });
+
+    // Transform the side planes into the space of the views.
+    for (std::size_t i = 0; i < 4; ++i) {
+        const auto n = rotate(q, normals[i]);
+        retval.planes[i] = { n.x, n.y, n.z, -frustum_dot(n, apex) };
+    }
+
+    // Move the near and far planes to the closest and farthest corner of the
+    // near and far planes of the views.
+    retval.near_plane = std::numeric_limits<float>::max();
+    retval.far_plane = infinite
+        ? std::numeric_limits<float>::infinity()
+        : 0.0f;
+
+    static const auto corner = [](const XrView& view, const XrVector3f& ray,
+            const float distance) {
+        const auto& p = view.pose.position;
+        return XrVector3f { p.x + distance * ray.x, p.y + distance * ray.y,
+            p.z + distance * ray.z };
+    };
+
+    static const auto depth = [](const XrVector3f& point,
+            const XrVector3f& apex, const XrVector3f& forward) {
+        return frustum_dot(forward, XrVector3f { point.x - apex.x,
+            point.y - apex.y, point.z - apex.z });
+    };
+
+    for (std::size_t i = 0; i < cnt; ++i) {
+        XrVector3f rays[4];
+        frustum_corner_rays(views[i], rays);
+
+        for (auto& r : rays) {
+            retval.near_plane = (std::min)(retval.near_plane,
+                depth(corner(views[i], r, near_plane), apex, forward));
+
+            if (!infinite) {
+                retval.far_plane = (std::max)(retval.far_plane,
+                    depth(corner(views[i], r, far_plane), apex, forward));
+            }
+        }
+    }
+
+    retval.near_plane = (std::max)(retval.near_plane * (1.0f - epsilon),
+        0.0f);
+    retval.far_plane *= 1.0f + epsilon;
+    retval.planes[4] = { forward.x, forward.y, forward.z,
+        -retval.near_plane - frustum_dot(forward, apex) };
+    retval.planes[5] = infinite
+        ? XrVector4f { 0.0f, 0.0f, 0.0f, 1.0f }
+        : XrVector4f { -forward.x, -forward.y, -forward.z,
+            frustum_dot(forward, apex) + retval.far_plane };
+
+    // Make sure that rounding errors do not exclude the corners of the views,
+    // which lie exactly on the planes of the combined frustum.
+    static const auto enclose = [](XrVector4f& plane, const XrVector3f& p) {
+        const auto d = frustum_dot(XrVector3f { plane.x, plane.y, plane.z },
+            p) + plane.w;
+        if (d < 0.0f) {
+            plane.w -= d;
+        }
+    };
+
+    for (std::size_t i = 0; i < cnt; ++i) {
+        XrVector3f rays[4];
+        frustum_corner_rays(views[i], rays);
+
+        for (std::size_t j = 0; j < 4; ++j) {
+            enclose(retval.planes[j], views[i].pose.position);
+        }
+
+        for (auto& r : rays) {
+            for (auto& p : retval.planes) {
+                enclose(p, corner(views[i], r, near_plane));
+                if (!infinite) {
+                    enclose(p, corner(views[i], r, far_plane));
+                }
+            }
+        }
+    }
+
+    retval.pose.orientation = q;
+    retval.pose.position = apex;
+    retval.fov.angleLeft = std::atan(left);
+    retval.fov.angleRight = std::atan(right);
+    retval.fov.angleDown = std::atan(bottom);
+    retval.fov.angleUp = std::atan(top);
+
+    return retval;
+}
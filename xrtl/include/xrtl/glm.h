@@ -9,12 +9,20 @@
 #pragma once
 
 #if defined(XRTL_WITH_GLM)
+#include <cassert>
+#include <cstddef>
+
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 
 #include <openxr/openxr.h>
 
 #include "xrtl/api.h"
+#include "xrtl/simd.h"
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
 
 
 XRTL_NAMESPACE_BEGIN
@@ -112,6 +120,148 @@ inline glm::mat4 to_glm(_In_ const XrPosef& p) noexcept {
     return retval;
 }
 
+
+/// <summary>
+/// Creates the GLM view matrix for an OpenXR pose, which is the inverse of
+/// the matrix created by <see cref="to_glm" />.
+/// </summary>
+/// <remarks>
+/// The inverse is computed analytically from the rigid transformation, which
+/// is considerably cheaper than using <c>glm::inverse</c>.
+/// </remarks>
+/// <param name="p">The pose of the view, whose orientation must be a unit
+/// quaternion.</param>
+/// <returns>The GLM matrix transforming from the space the pose is
+/// relative to into the space of the view.</returns>
+inline glm::mat4 to_view_matrix(_In_ const XrPosef& p) noexcept {
+    static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "The matrix is "
+        "assumed to consist of sixteen floats.");
+    glm::mat4 retval;
+    store_simd_matrix(glm::value_ptr(retval), load_simd_view_matrix(p));
+    return retval;
+}
+
+
+/// <summary>
+/// Converts a batch of OpenXR poses into GLM matrices.
+/// </summary>
+/// <remarks>
+/// The results are the same as the ones of converting each pose individually,
+/// but multiple poses are processed at once if SIMD instructions are
+/// available.
+/// </remarks>
+/// <param name="poses">The poses to be transformed.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" /> and
+/// <paramref name="matrices" />.</param>
+/// <param name="matrices">Receives the matrices in the order of the input.
+/// </param>
+inline void to_matrices(_In_reads_(cnt) const XrPosef *poses,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) glm::mat4 *matrices) noexcept {
+    static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "The matrix is "
+        "assumed to consist of sixteen floats.");
+    to_matrices(poses, cnt, reinterpret_cast<float *>(matrices));
+}
+
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Converts a batch of OpenXR poses into GLM matrices.
+/// </summary>
+/// <param name="poses">The poses to be transformed.</param>
+/// <param name="matrices">Receives the matrices in the order of the input.
+/// This span must have the same size as <paramref name="poses" />.</param>
+inline void to_matrices(_In_ const std::span<const XrPosef> poses,
+        _In_ const std::span<glm::mat4> matrices) noexcept {
+    assert(poses.size() == matrices.size());
+    to_matrices(poses.data(), poses.size(), matrices.data());
+}
+#endif /* defined(__cpp_lib_span) */
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Maps an OpenXR type to the GLM type with the same memory layout.
+/// </summary>
+template<class TType> struct glm_view_type { };
+
+template<> struct glm_view_type<XrVector2f> { typedef glm::vec2 type; };
+template<> struct glm_view_type<XrExtent2Df> { typedef glm::vec2 type; };
+template<> struct glm_view_type<XrVector3f> { typedef glm::vec3 type; };
+template<> struct glm_view_type<XrVector4f> { typedef glm::vec4 type; };
+template<> struct glm_view_type<XrQuaternionf> { typedef glm::quat type; };
+
+template<> struct openxr_view_type<glm::vec2> { typedef XrVector2f type; };
+template<> struct openxr_view_type<glm::vec3> { typedef XrVector3f type; };
+template<> struct openxr_view_type<glm::vec4> { typedef XrVector4f type; };
+template<> struct openxr_view_type<glm::quat> { typedef XrQuaternionf type; };
+
+// Depending on the version and configuration, GLM stores the real part of
+// quaternions first or last, which is why the views of quaternions are only
+// valid if the offsets of the components match.
+template<> struct same_component_order<glm::quat, XrQuaternionf>
+    : std::integral_constant<bool,
+        (offsetof(glm::quat, x) == offsetof(XrQuaternionf, x))
+        && (offsetof(glm::quat, w) == offsetof(XrQuaternionf, w))> { };
+template<> struct same_component_order<XrQuaternionf, glm::quat>
+    : same_component_order<glm::quat, XrQuaternionf> { };
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Views an array of OpenXR vectors, extents or quaternions as the
+/// equivalent GLM type without copying.
+/// </summary>
+/// <remarks>
+/// <para>Unlike <see cref="to_glm" />, this does not copy any data, so it
+/// is suitable for large arrays like hand joint positions or mesh vertices.
+/// Modifications of the GLM vectors are visible in the OpenXR input. The
+/// returned pointer addresses as many elements as <paramref name="p" />.
+/// </para>
+/// <para>The layout of the types is checked at compile time, so the views
+/// are not available if GLM is configured to use aligned types with
+/// padding. Quaternions are only available if GLM stores the real part last
+/// like OpenXR, which requires <c>GLM_FORCE_QUAT_DATA_XYZW</c> for GLM
+/// 1.0 and later.</para>
+/// </remarks>
+/// <typeparam name="TType">The OpenXR type, which may be <c>const</c>.
+/// </typeparam>
+/// <param name="p">A pointer to the elements to be reinterpreted.</param>
+/// <returns>A pointer to GLM vectors aliasing the same memory.</returns>
+template<class TType>
+inline detail::view_t<detail::glm_view_type, TType> *as_glm(
+        _In_opt_ TType *p) noexcept {
+    return detail::view_cast<detail::view_t<detail::glm_view_type, TType>>(p);
+}
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Views a span of OpenXR vectors, extents or quaternions as the equivalent
+/// GLM type without copying.
+/// </summary>
+/// <remarks>
+/// The same restrictions as for the pointer overload apply.
+/// </remarks>
+/// <typeparam name="TType">The OpenXR type, which may be <c>const</c>.
+/// </typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="s">The span to be reinterpreted.</param>
+/// <returns>A span of GLM vectors aliasing the same memory.</returns>
+template<class TType, std::size_t Extent>
+inline detail::span_view_t<detail::glm_view_type, TType, Extent> as_glm(
+        _In_ const std::span<TType, Extent> s) noexcept {
+    typedef detail::span_view_t<detail::glm_view_type, TType, Extent>
+        result_type;
+    return detail::span_cast<typename result_type::element_type>(s);
+}
+#endif /* defined(__cpp_lib_span) */
+
 XRTL_NAMESPACE_END
 
 #endif /* defined(XRTL_WITH_GLM) */
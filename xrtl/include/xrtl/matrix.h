@@ -10,11 +10,246 @@
 
 #include <cassert>
 #include <cmath>
+#include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 #include <openxr/openxr.h>
 
 #include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/expected.h"
+#include "xrtl/simd.h"
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Checks whether the given field of view and clipping planes can be used to
+/// create a projection matrix.
+/// </summary>
+/// <param name="fov">The field of view from OpenXR.</param>
+/// <param name="near_plane">The distance to the near clipping plane.</param>
+/// <param name="far_plane">The distance to the far clipping plane.</param>
+/// <returns><c>nullptr</c> if the input is valid, a description of the
+/// problem otherwise.</returns>
+inline _Ret_maybenull_z_ const char *validate_projection(
+    _In_ const XrFovf& fov,
+    _In_ const float near_plane,
+    _In_ const float far_plane) noexcept;
+
+/// <summary>
+/// Creates a projection matrix using the given builder without validating
+/// the input.
+/// </summary>
+/// <typeparam name="TBuilder">The type of the function or lambda making an
+/// off-centre matrix.</typeparam>
+/// <param name="builder">The builder function creating the matrix.</param>
+/// <param name="fov">The field of view from OpenXR, which must have been
+/// checked using <see cref="validate_projection" />.</param>
+/// <param name="near_plane">The distance to the near clipping plane.</param>
+/// <param name="far_plane">The distance to the far clipping plane.</param>
+/// <returns>The projection matrix created by the <paramref name="builder" />.
+/// </returns>
+template<class TBuilder> auto make_unchecked_matrix(
+    _In_ const TBuilder& builder,
+    _In_ const XrFovf& fov,
+    _In_ const float near_plane,
+    _In_ const float far_plane)
+    -> decltype(builder(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+
+/// <summary>
+/// Creates an off-centre projection matrix for the given clip space from the
+/// terms mapping the view-space z-coordinate to depth in a right-handed,
+/// y-up clip space with a depth range of [0, 1].
+/// </summary>
+/// <remarks>
+/// The conversion into the target clip space only changes the signs and the
+/// depth terms, which is cheaper than multiplying with a conversion matrix.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix to be created, which
+/// must consist of sixteen floats in the memory layout of <c>glm::mat4</c>
+/// and <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <typeparam name="TClipSpace">An instance of <see cref="clip_space" />
+/// describing the target conventions.</typeparam>
+/// <param name="left">The left extent of the near plane.</param>
+/// <param name="right">The right extent of the near plane.</param>
+/// <param name="bottom">The bottom extent of the near plane.</param>
+/// <param name="top">The top extent of the near plane.</param>
+/// <param name="near_plane">The distance to the near plane.</param>
+/// <param name="depth_scale">The factor for the z-coordinate in the depth
+/// row, which is the third element of the third column of a
+/// <c>glm::mat4</c>.</param>
+/// <param name="depth_offset">The constant term of the depth row, which is
+/// the third element of the fourth column of a <c>glm::mat4</c>.</param>
+/// <returns>The projection matrix.</returns>
+template<class TMatrix, class TClipSpace> TMatrix make_off_centre(
+    _In_ const float left,
+    _In_ const float right,
+    _In_ const float bottom,
+    _In_ const float top,
+    _In_ const float near_plane,
+    _In_ const float depth_scale,
+    _In_ const float depth_offset) noexcept;
+
+/// <summary>
+/// Inverts an off-centre projection matrix analytically.
+/// </summary>
+/// <remarks>
+/// The matrix must have the structure of the matrices created by
+/// <c>glm::frustum*</c>, <c>DirectX::XMMatrixPerspectiveOffCenter*</c> and
+/// <see cref="make_off_centre" />, ie only the diagonal of the upper 3x3
+/// part, the third column and the depth offset must be non-zero.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix, which must consist of
+/// sixteen floats in the memory layout of <c>glm::mat4</c> and
+/// <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <param name="matrix">The projection matrix to be inverted.</param>
+/// <returns>The inverse of <paramref name="matrix" />.</returns>
+template<class TMatrix> TMatrix invert_off_centre(
+    _In_ const TMatrix& matrix) noexcept;
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A validation policy for <see cref="make_matrix" /> that checks the input
+/// on every call and reports invalid input via the given error policy.
+/// </summary>
+/// <remarks>
+/// This is the behaviour of <see cref="make_matrix" /> if no validation
+/// policy is specified.
+/// </remarks>
+/// <typeparam name="TErrorPolicy">The error policy that is notified about
+/// invalid input and that determines the return type.</typeparam>
+template<class TErrorPolicy = default_error_policy>
+struct checked_validation final {
+
+    /// <summary>
+    /// Indicates that the input is checked at run time.
+    /// </summary>
+    static constexpr bool checked = true;
+
+    /// <summary>
+    /// The error policy that is notified about invalid input.
+    /// </summary>
+    typedef TErrorPolicy error_policy;
+
+    /// <summary>
+    /// The type returned by <see cref="make_matrix" /> for a matrix of type
+    /// <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue>
+    using result_type = typename error_policy::template result_type<TValue>;
+};
+
+
+/// <summary>
+/// A validation policy for <see cref="make_matrix" /> that only asserts
+/// valid input in debug builds.
+/// </summary>
+/// <remarks>
+/// In release builds, this policy is equivalent to
+/// <see cref="unchecked_validation" />.
+/// </remarks>
+struct assert_validation final {
+
+    /// <summary>
+    /// Indicates that the input is not checked at run time in release builds.
+    /// </summary>
+    static constexpr bool checked = false;
+
+    /// <summary>
+    /// The type returned by <see cref="make_matrix" /> for a matrix of type
+    /// <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = TValue;
+
+    /// <summary>
+    /// Asserts that the given input is valid.
+    /// </summary>
+    static inline void verify(_In_ const XrFovf& fov,
+            _In_ const float near_plane,
+            _In_ const float far_plane) noexcept {
+        assert(detail::validate_projection(fov, near_plane, far_plane)
+            == nullptr);
+        (void) fov;
+        (void) near_plane;
+        (void) far_plane;
+    }
+};
+
+
+/// <summary>
+/// A validation policy for <see cref="make_matrix" /> that does not check
+/// the input at all.
+/// </summary>
+/// <remarks>
+/// The caller is responsible for passing a valid field of view and valid
+/// clipping planes. Otherwise, the result is the one of the builder for the
+/// given input, which might be infinite or NaN.
+/// </remarks>
+struct unchecked_validation final {
+
+    /// <summary>
+    /// Indicates that the input is not checked at run time.
+    /// </summary>
+    static constexpr bool checked = false;
+
+    /// <summary>
+    /// The type returned by <see cref="make_matrix" /> for a matrix of type
+    /// <typeparamref name="TValue" />.
+    /// </summary>
+    template<class TValue> using result_type = TValue;
+
+    /// <summary>
+    /// Accepts any input.
+    /// </summary>
+    static inline void verify(_In_ const XrFovf&,
+        _In_ const float,
+        _In_ const float) noexcept { }
+};
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Maps the policy passed to <see cref="make_matrix" /> to a validation
+/// policy, which allows for passing an error policy instead of
+/// <see cref="checked_validation" />.
+/// </summary>
+template<class TPolicy> struct validation_policy final {
+    typedef checked_validation<TPolicy> type;
+};
+
+/// <summary>
+/// Specialisation for <see cref="checked_validation" />.
+/// </summary>
+template<class TErrorPolicy>
+struct validation_policy<checked_validation<TErrorPolicy>> final {
+    typedef checked_validation<TErrorPolicy> type;
+};
+
+/// <summary>
+/// Specialisation for <see cref="assert_validation" />.
+/// </summary>
+template<> struct validation_policy<assert_validation> final {
+    typedef assert_validation type;
+};
+
+/// <summary>
+/// Specialisation for <see cref="unchecked_validation" />.
+/// </summary>
+template<> struct validation_policy<unchecked_validation> final {
+    typedef unchecked_validation type;
+};
+
+XRTL_DETAIL_NAMESPACE_END
 
 
 XRTL_NAMESPACE_BEGIN
@@ -36,12 +271,404 @@ XRTL_NAMESPACE_BEGIN
 /// <param name="far_plane">The distance to the far clipping plane.</param>
 /// <returns>The projection matrix created by the <paramref name="builder" />.
 /// </returns>
+/// <exception cref="std::invalid_argument">If the field of view or the
+/// clipping planes are invalid and the <see cref="default_error_policy" />
+/// throws.</exception>
 template<class TBuilder> auto make_matrix(
     _In_ const TBuilder& builder,
     _In_ const XrFovf& fov,
     _In_ const float near_plane,
     _In_ const float far_plane)
-    -> decltype(builder(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+    -> typename default_error_policy::template result_type<
+    decltype(builder(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f))>;
+
+/// <summary>
+/// Creates a projection matrix using the given OpenXR field of view and the
+/// clipping range between <see cref="near_plane" /> and
+/// <see cref="far_plane" />, validating the input as configured by the given
+/// policy.
+/// </summary>
+/// <remarks>
+/// With <see cref="assert_validation" /> and
+/// <see cref="unchecked_validation" />, the function does not branch on the
+/// input in release builds and does not throw. The builder is expected not
+/// to throw either.
+/// </remarks>
+/// <typeparam name="TPolicy">Either a validation policy like
+/// <see cref="unchecked_validation" /> or an error policy like
+/// <see cref="return_error_policy" />, which is equivalent to
+/// <see cref="checked_validation" /> using this error policy. The latter
+/// yields an <see cref="expected" /> holding
+/// <c>XR_ERROR_VALIDATION_FAILURE</c> for invalid input.</typeparam>
+/// <typeparam name="TBuilder">The type of the function or lambda making an
+/// off-centre matrix.</typeparam>
+/// <param name="builder">The builder function creating the matrix.</param>
+/// <param name="fov">The field of view from OpenXR.</param>
+/// <param name="near_plane">The distance to the near clipping plane, which
+/// must be positive.</param>
+/// <param name="far_plane">The distance to the far clipping plane.</param>
+/// <returns>The projection matrix created by the <paramref name="builder" />
+/// in the form required by <typeparamref name="TPolicy" />.</returns>
+template<class TPolicy, class TBuilder> auto make_matrix(
+    _In_ const TBuilder& builder,
+    _In_ const XrFovf& fov,
+    _In_ const float near_plane,
+    _In_ const float far_plane)
+    noexcept(!detail::validation_policy<TPolicy>::type::checked)
+    -> typename detail::validation_policy<TPolicy>::type::template
+    result_type<decltype(builder(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f))>;
+
+
+/// <summary>
+/// Selects a clip space in which the y-axis points up.
+/// </summary>
+struct y_up final {
+    /// <summary>
+    /// The factor applied to the y-coordinate.
+    /// </summary>
+    static constexpr float sign = 1.0f;
+};
+
+/// <summary>
+/// Selects a clip space in which the y-axis points down as in Vulkan.
+/// </summary>
+struct y_down final {
+    /// <summary>
+    /// The factor applied to the y-coordinate.
+    /// </summary>
+    static constexpr float sign = -1.0f;
+};
+
+/// <summary>
+/// Selects a depth range of [0, 1] as in Direct3D and Vulkan.
+/// </summary>
+struct zero_to_one final { };
+
+/// <summary>
+/// Selects a depth range of [-1, 1] as in OpenGL.
+/// </summary>
+struct minus_one_to_one final { };
+
+/// <summary>
+/// Selects a right-handed view space, which looks along the negative z-axis
+/// like the views reported by OpenXR.
+/// </summary>
+struct right_handed final {
+    /// <summary>
+    /// The factor applied to the z-coordinate in view space.
+    /// </summary>
+    static constexpr float sign = 1.0f;
+};
+
+/// <summary>
+/// Selects a left-handed view space, which looks along the positive z-axis.
+/// </summary>
+struct left_handed final {
+    /// <summary>
+    /// The factor applied to the z-coordinate in view space.
+    /// </summary>
+    static constexpr float sign = -1.0f;
+};
+
+
+/// <summary>
+/// Describes the conventions of the clip space that a projection matrix
+/// created by the builders of xrtl transforms into.
+/// </summary>
+/// <remarks>
+/// The conventions are applied when the matrix is built, so there is no need
+/// to convert the result of <see cref="make_matrix" /> afterwards.
+/// </remarks>
+/// <typeparam name="TYAxis">Either <see cref="y_up" /> or
+/// <see cref="y_down" />.</typeparam>
+/// <typeparam name="TDepthRange">Either <see cref="zero_to_one" /> or
+/// <see cref="minus_one_to_one" />.</typeparam>
+/// <typeparam name="THandedness">Either <see cref="right_handed" /> or
+/// <see cref="left_handed" />, which refers to the view space.</typeparam>
+template<class TYAxis, class TDepthRange, class THandedness>
+struct clip_space final {
+
+    /// <summary>
+    /// The direction of the y-axis.
+    /// </summary>
+    typedef TYAxis y_axis;
+
+    /// <summary>
+    /// The depth range.
+    /// </summary>
+    typedef TDepthRange depth_range;
+
+    /// <summary>
+    /// The handedness of the view space.
+    /// </summary>
+    typedef THandedness handedness;
+};
+
+/// <summary>
+/// The clip space of Direct3D for the right-handed view space of OpenXR.
+/// </summary>
+typedef clip_space<y_up, zero_to_one, right_handed> direct3d_clip_space;
+
+/// <summary>
+/// The clip space of OpenGL for the right-handed view space of OpenXR.
+/// </summary>
+typedef clip_space<y_up, minus_one_to_one, right_handed> opengl_clip_space;
+
+/// <summary>
+/// The clip space of Vulkan for the right-handed view space of OpenXR.
+/// </summary>
+typedef clip_space<y_down, zero_to_one, right_handed> vulkan_clip_space;
+
+
+/// <summary>
+/// A builder for <see cref="make_matrix" /> creating an off-centre
+/// projection for the given clip space.
+/// </summary>
+/// <remarks>
+/// For <see cref="direct3d_clip_space" />, the matrix is the one of
+/// <c>glm::frustumRH_ZO</c> and
+/// <c>DirectX::XMMatrixPerspectiveOffCenterRH</c>, for
+/// <see cref="opengl_clip_space" />, it is the one of
+/// <c>glm::frustumRH_NO</c>.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix to be created, which
+/// must consist of sixteen floats in the memory layout of <c>glm::mat4</c>
+/// and <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <typeparam name="TClipSpace">The conventions of the clip space, which
+/// default to the ones of Direct3D.</typeparam>
+template<class TMatrix, class TClipSpace = direct3d_clip_space>
+struct perspective_projection final {
+
+    /// <summary>
+    /// Creates the projection matrix.
+    /// </summary>
+    /// <param name="left">The left extent of the near plane.</param>
+    /// <param name="right">The right extent of the near plane.</param>
+    /// <param name="bottom">The bottom extent of the near plane.</param>
+    /// <param name="top">The top extent of the near plane.</param>
+    /// <param name="near_plane">The distance to the near plane.</param>
+    /// <param name="far_plane">The distance to the far plane.</param>
+    /// <returns>The projection matrix.</returns>
+    TMatrix operator ()(_In_ const float left,
+        _In_ const float right,
+        _In_ const float bottom,
+        _In_ const float top,
+        _In_ const float near_plane,
+        _In_ const float far_plane) const noexcept;
+};
+
+
+/// <summary>
+/// A builder for <see cref="make_matrix" /> creating an off-centre
+/// projection with reversed depth, ie the near plane is mapped to the
+/// maximum depth and the far plane to the minimum.
+/// </summary>
+/// <remarks>
+/// <para>The matrix is the one of <see cref="perspective_projection" />
+/// with the depth reversed. Reversing the depth distributes the precision of
+/// floating-point depth buffers much more evenly across the view frustum.
+/// The depth test must be changed to "greater" and the depth buffer must be
+/// cleared to the minimum depth.</para>
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix to be created, which
+/// must consist of sixteen floats in the memory layout of <c>glm::mat4</c>
+/// and <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <typeparam name="TClipSpace">The conventions of the clip space, which
+/// default to the ones of Direct3D.</typeparam>
+template<class TMatrix, class TClipSpace = direct3d_clip_space>
+struct reverse_z_projection final {
+
+    /// <summary>
+    /// Creates the projection matrix.
+    /// </summary>
+    /// <param name="left">The left extent of the near plane.</param>
+    /// <param name="right">The right extent of the near plane.</param>
+    /// <param name="bottom">The bottom extent of the near plane.</param>
+    /// <param name="top">The top extent of the near plane.</param>
+    /// <param name="near_plane">The distance to the near plane.</param>
+    /// <param name="far_plane">The distance to the far plane.</param>
+    /// <returns>The projection matrix.</returns>
+    TMatrix operator ()(_In_ const float left,
+        _In_ const float right,
+        _In_ const float bottom,
+        _In_ const float top,
+        _In_ const float near_plane,
+        _In_ const float far_plane) const noexcept;
+};
+
+
+/// <summary>
+/// A builder for <see cref="make_matrix" /> creating an off-centre
+/// projection with the far plane at infinity, which maps the near plane to
+/// the minimum depth and infinity to the maximum.
+/// </summary>
+/// <remarks>
+/// The matrix is the limit of <see cref="perspective_projection" /> for an
+/// infinitely distant far plane. The distance to the far plane passed to the
+/// builder is ignored.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix to be created, which
+/// must consist of sixteen floats in the memory layout of <c>glm::mat4</c>
+/// and <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <typeparam name="TClipSpace">The conventions of the clip space, which
+/// default to the ones of Direct3D.</typeparam>
+template<class TMatrix, class TClipSpace = direct3d_clip_space>
+struct infinite_projection final {
+
+    /// <summary>
+    /// Creates the projection matrix.
+    /// </summary>
+    /// <param name="left">The left extent of the near plane.</param>
+    /// <param name="right">The right extent of the near plane.</param>
+    /// <param name="bottom">The bottom extent of the near plane.</param>
+    /// <param name="top">The top extent of the near plane.</param>
+    /// <param name="near_plane">The distance to the near plane.</param>
+    /// <param name="far_plane">Ignored.</param>
+    /// <returns>The projection matrix.</returns>
+    TMatrix operator ()(_In_ const float left,
+        _In_ const float right,
+        _In_ const float bottom,
+        _In_ const float top,
+        _In_ const float near_plane,
+        _In_ const float far_plane) const noexcept;
+};
+
+
+/// <summary>
+/// A builder for <see cref="make_matrix" /> creating an off-centre
+/// projection with the far plane at infinity and reversed depth, which maps
+/// the near plane to the maximum depth and infinity to the minimum.
+/// </summary>
+/// <remarks>
+/// This is the combination of <see cref="reverse_z_projection" /> and
+/// <see cref="infinite_projection" />, which is typically the best choice
+/// for floating-point depth buffers with a depth range of [0, 1]. The
+/// distance to the far plane passed to the builder is ignored.
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the matrix to be created, which
+/// must consist of sixteen floats in the memory layout of <c>glm::mat4</c>
+/// and <c>DirectX::XMMATRIX</c>.</typeparam>
+/// <typeparam name="TClipSpace">The conventions of the clip space, which
+/// default to the ones of Direct3D.</typeparam>
+template<class TMatrix, class TClipSpace = direct3d_clip_space>
+struct infinite_reverse_z_projection final {
+
+    /// <summary>
+    /// Creates the projection matrix.
+    /// </summary>
+    /// <param name="left">The left extent of the near plane.</param>
+    /// <param name="right">The right extent of the near plane.</param>
+    /// <param name="bottom">The bottom extent of the near plane.</param>
+    /// <param name="top">The top extent of the near plane.</param>
+    /// <param name="near_plane">The distance to the near plane.</param>
+    /// <param name="far_plane">Ignored.</param>
+    /// <returns>The projection matrix.</returns>
+    TMatrix operator ()(_In_ const float left,
+        _In_ const float right,
+        _In_ const float bottom,
+        _In_ const float top,
+        _In_ const float near_plane,
+        _In_ const float far_plane) const noexcept;
+};
+
+
+/// <summary>
+/// A builder for <see cref="make_matrix" /> creating the inverse of the
+/// projection matrix created by another builder.
+/// </summary>
+/// <remarks>
+/// <para>The inverse is computed analytically from the seven non-zero
+/// elements of the off-centre projection, which is considerably cheaper than
+/// a general 4x4 inverse and at least as accurate. The inverse transforms
+/// from clip space into view space, for instance to reconstruct positions
+/// from depth.</para>
+/// <para>The wrapped builder can be any off-centre builder including the
+/// ones of glm and DirectX Math.</para>
+/// </remarks>
+/// <typeparam name="TBuilder">The type of the builder creating the
+/// projection matrix to be inverted.</typeparam>
+template<class TBuilder> class inverse_projection final {
+
+public:
+
+    /// <summary>
+    /// The type of the builder creating the projection matrix.
+    /// </summary>
+    typedef TBuilder builder_type;
+
+    /// <summary>
+    /// The type of the matrices created by the builder.
+    /// </summary>
+    typedef decltype(std::declval<const builder_type&>()(0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f)) matrix_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="builder">The builder creating the projection matrix.
+    /// </param>
+    inline inverse_projection(
+            _In_ const builder_type& builder = builder_type())
+        : _builder(builder) { }
+
+    /// <summary>
+    /// Creates the inverse projection matrix.
+    /// </summary>
+    /// <param name="left">The left extent of the near plane.</param>
+    /// <param name="right">The right extent of the near plane.</param>
+    /// <param name="bottom">The bottom extent of the near plane.</param>
+    /// <param name="top">The top extent of the near plane.</param>
+    /// <param name="near_plane">The distance to the near plane.</param>
+    /// <param name="far_plane">The distance to the far plane.</param>
+    /// <returns>The inverse of the projection matrix.</returns>
+    inline matrix_type operator ()(_In_ const float left,
+            _In_ const float right,
+            _In_ const float bottom,
+            _In_ const float top,
+            _In_ const float near_plane,
+            _In_ const float far_plane) const {
+        return detail::invert_off_centre(this->_builder(left, right, bottom,
+            top, near_plane, far_plane));
+    }
+
+private:
+
+    builder_type _builder;
+};
+
+/// <summary>
+/// Deduces the builder from function pointers and lambdas.
+/// </summary>
+template<class TBuilder>
+inverse_projection(TBuilder) -> inverse_projection<TBuilder>;
+
+
+/// <summary>
+/// Computes the normalised directions of the rays through the centres of the
+/// pixels in the given part of the image of a view.
+/// </summary>
+/// <remarks>
+/// <para>The rays are in the right-handed view space of OpenXR, ie the view
+/// looks along the negative z-axis, the x-axis points to the right and the
+/// y-axis points up. The first row of pixels is at the top of the image, so
+/// the rays are in the memory order of Direct3D and Vulkan images.</para>
+/// <para>The directions are computed from the tangents of the field of view
+/// without using a projection matrix. If a SIMD backend is available, four
+/// rays are computed at once.</para>
+/// </remarks>
+/// <param name="fov">The field of view of the view.</param>
+/// <param name="extent">The size of the image rectangle of the view in
+/// pixels, which covers the whole field of view.</param>
+/// <param name="rect">The pixels to compute the rays for, relative to the
+/// image rectangle of the view.</param>
+/// <param name="rays">Receives
+/// <c>rect.extent.width * rect.extent.height</c> directions in row-major
+/// order.</param>
+void make_view_rays(_In_ const XrFovf& fov,
+    _In_ const XrExtent2Di& extent,
+    _In_ const XrRect2Di& rect,
+    _Out_writes_(rect.extent.width * rect.extent.height) XrVector3f *rays)
+    noexcept;
 
 XRTL_NAMESPACE_END
 
@@ -0,0 +1,148 @@
+﻿// <copyright file="parse_paths.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_PARSE_PATHS_H)
+#define _XRTL_PARSE_PATHS_H
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Resolves a batch of path strings, converting each distinct string only
+/// once.
+/// </summary>
+/// <typeparam name="TResolve">The type of the functor converting a single
+/// null-terminated string to an <see cref="XrPath" />, which must be
+/// thread-safe if <paramref name="workers" /> is larger than one.</typeparam>
+/// <param name="paths">The string representations of the paths.</param>
+/// <param name="cnt">The number of elements in <paramref name="paths" /> and
+/// <paramref name="outputs" />.</param>
+/// <param name="outputs">Receives the paths in the order of the input.</param>
+/// <param name="workers">The maximum number of threads used to convert the
+/// distinct strings, including the calling one.</param>
+/// <param name="resolve">The functor converting a single string.</param>
+/// <exception cref="std::system_error">If any of the conversions failed. If
+/// multiple conversions failed, the exception of one of them is rethrown.
+/// </exception>
+template<class TResolve>
+void parse_paths(_In_reads_(cnt) const char *const *paths,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) XrPath *outputs,
+        _In_ const std::size_t workers,
+        _In_ TResolve&& resolve) {
+    assert((paths != nullptr) || (cnt == 0));
+    assert((outputs != nullptr) || (cnt == 0));
+
+    // Assign each distinct string an index into 'unique', which will receive
+    // the converted path.
+    std::vector<std::size_t> indices(cnt);
+    std::vector<const char *> unique;
+    std::unordered_map<std::string_view, std::size_t> seen;
+    seen.reserve(cnt);
+    unique.reserve(cnt);
+
+    for (std::size_t i = 0; i < cnt; ++i) {
+        assert(paths[i] != nullptr);
+        auto it = seen.emplace(paths[i], unique.size());
+        if (it.second) {
+            unique.push_back(paths[i]);
+        }
+        indices[i] = it.first->second;
+    }
+
+    // Convert the distinct strings. The workers pick the next string from a
+    // shared counter such that slow calls do not stall a whole chunk.
+    std::vector<XrPath> resolved(unique.size(), XR_NULL_PATH);
+    std::atomic<std::size_t> next(0);
+#if XRTL_HAS_EXCEPTIONS
+    auto work = [&](void) {
+        try {
+            for (auto i = next.fetch_add(1); i < unique.size();
+                    i = next.fetch_add(1)) {
+                resolved[i] = resolve(unique[i]);
+            }
+        } catch (...) {
+            // Stop the other workers as the batch has failed anyway.
+            next.store(unique.size());
+            throw;
+        }
+    };
+#else /* XRTL_HAS_EXCEPTIONS */
+    // Without exceptions, 'resolve' reports failures via the error policy,
+    // which either does not return or yields XR_NULL_PATH.
+    auto work = [&](void) {
+        for (auto i = next.fetch_add(1); i < unique.size();
+                i = next.fetch_add(1)) {
+            resolved[i] = resolve(unique[i]);
+        }
+    };
+#endif /* XRTL_HAS_EXCEPTIONS */
+
+    const auto cnt_threads = (std::min)((std::max)(workers, std::size_t(1)),
+        unique.size());
+    std::vector<std::future<void>> threads;
+    if (cnt_threads > 1) {
+        threads.reserve(cnt_threads - 1);
+        for (std::size_t t = 1; t < cnt_threads; ++t) {
+            threads.push_back(std::async(std::launch::async, work));
+        }
+    }
+
+#if XRTL_HAS_EXCEPTIONS
+    // Make sure that all workers have completed before rethrowing the first
+    // error, because they reference our local variables.
+    std::exception_ptr error;
+    try {
+        work();
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    for (auto& t : threads) {
+        try {
+            t.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#else /* XRTL_HAS_EXCEPTIONS */
+    work();
+
+    for (auto& t : threads) {
+        t.get();
+    }
+#endif /* XRTL_HAS_EXCEPTIONS */
+
+    for (std::size_t i = 0; i < cnt; ++i) {
+        outputs[i] = resolved[indices[i]];
+    }
+}
+
+XRTL_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_XRTL_PARSE_PATHS_H) */
@@ -10,13 +10,24 @@
 
 #include <cassert>
 #include <cinttypes>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 #include <openxr/openxr.h>
 
+#include "xrtl/dispatch_table.h"
+#include "xrtl/expected.h"
+#include "xrtl/parse_paths.h"
+#include "xrtl/path_cache.h"
+#include "xrtl/path_literal.h"
 #include "xrtl/result.h"
 #include "xrtl/unique_handle.h"
 
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
+
 
 XRTL_NAMESPACE_BEGIN
 
@@ -57,6 +68,262 @@ public:
         return parse(instance.get(), path);
     }
 
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    static inline XrPath parse(_In_ const dispatch_table& table,
+            _In_z_ const char *path) {
+        assert(table);
+        assert(path != nullptr);
+        XrPath retval;
+        THROW_IF_XR_FAILED(table.xrStringToPath(table.instance(), path,
+            &retval));
+        return retval;
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion. If the path has been converted before, the
+    /// runtime will not be called.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    static inline XrPath parse(_In_ path_cache& cache,
+            _In_z_ const char *path) {
+        assert(path != nullptr);
+        return cache.parse(path);
+    }
+
+    /// <summary>
+    /// Resolves the given OpenXR path literal.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion. The runtime will only be called the first time
+    /// the literal is resolved.</param>
+    /// <param name="path">The path literal, which has been created using the
+    /// <c>_xrpath</c> suffix.</param>
+    /// <returns>The OpenXR path represented by the given literal.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    static inline XrPath parse(_In_ path_cache& cache,
+            _In_ const path_literal& path) {
+        return cache.parse(path);
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation without
+    /// throwing an exception if the operation fails.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string or the error
+    /// code of the runtime.</returns>
+    static inline expected<XrPath> try_parse(_In_ const XrInstance instance,
+            _In_z_ const char *path) noexcept {
+        assert(instance != XR_NULL_HANDLE);
+        assert(path != nullptr);
+        XrPath retval;
+        auto status = ::xrStringToPath(instance, path, &retval);
+        if (XR_FAILED(status)) {
+            return status;
+        } else {
+            return expected<XrPath>(retval, status);
+        }
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation without
+    /// throwing an exception if the operation fails.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string or the error
+    /// code of the runtime.</returns>
+    static inline expected<XrPath> try_parse(
+            _In_ const unique_instance& instance,
+            _In_z_ const char *path) noexcept {
+        return try_parse(instance.get(), path);
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation without
+    /// throwing an exception if the operation fails.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string or the error
+    /// code of the runtime.</returns>
+    static inline expected<XrPath> try_parse(_In_ const dispatch_table& table,
+            _In_z_ const char *path) noexcept {
+        assert(table);
+        assert(path != nullptr);
+        XrPath retval;
+        auto status = table.xrStringToPath(table.instance(), path, &retval);
+        if (XR_FAILED(status)) {
+            return status;
+        } else {
+            return expected<XrPath>(retval, status);
+        }
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation without
+    /// throwing an exception if the conversion fails.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string or the error
+    /// code of the runtime.</returns>
+    static inline expected<XrPath> try_parse(_In_ path_cache& cache,
+            _In_z_ const char *path) {
+        assert(path != nullptr);
+        return cache.try_parse(path);
+    }
+
+    /// <summary>
+    /// Parses the given OpenXR path from its string representation and
+    /// handles failures as configured by the given error policy.
+    /// </summary>
+    /// <typeparam name="TErrorPolicy">The error policy, for instance
+    /// <see cref="return_error_policy" />.</typeparam>
+    /// <typeparam name="TContext">The type of the object performing the
+    /// conversion, which is an <see cref="XrInstance" />, a
+    /// <see cref="unique_instance" />, a <see cref="dispatch_table" /> or a
+    /// <see cref="path_cache" />.</typeparam>
+    /// <param name="context">The object performing the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string in the form
+    /// required by <typeparamref name="TErrorPolicy" />.</returns>
+    template<class TErrorPolicy, class TContext>
+    static inline typename TErrorPolicy::template result_type<XrPath> parse(
+            _In_ TContext&& context,
+            _In_z_ const char *path) {
+        return detail::apply_error_policy<TErrorPolicy>(
+            try_parse(std::forward<TContext>(context), path),
+            path);
+    }
+
+    /// <summary>
+    /// Parses a batch of OpenXR paths from their string representations.
+    /// </summary>
+    /// <remarks>
+    /// Each distinct string is converted only once, optionally using
+    /// multiple threads.
+    /// </remarks>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="paths">The string representations of the paths.</param>
+    /// <param name="cnt">The number of elements in <paramref name="paths" />
+    /// and <paramref name="outputs" />.</param>
+    /// <param name="outputs">Receives the OpenXR paths in the order of
+    /// <paramref name="paths" />.</param>
+    /// <param name="workers">The maximum number of threads used for the
+    /// conversion, including the calling one.</param>
+    /// <exception cref="std::system_error">If any of the conversions failed.
+    /// </exception>
+    static inline void parse(_In_ const XrInstance instance,
+            _In_reads_(cnt) const char *const *paths,
+            _In_ const std::size_t cnt,
+            _Out_writes_(cnt) XrPath *outputs,
+            _In_ const std::size_t workers = 1) {
+        detail::parse_paths(paths, cnt, outputs, workers,
+            [instance](const char *p) { return parse(instance, p); });
+    }
+
+    /// <summary>
+    /// Parses a batch of OpenXR paths from their string representations.
+    /// </summary>
+    /// <remarks>
+    /// Each distinct string is converted only once, optionally using
+    /// multiple threads.
+    /// </remarks>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="paths">The string representations of the paths.</param>
+    /// <param name="cnt">The number of elements in <paramref name="paths" />
+    /// and <paramref name="outputs" />.</param>
+    /// <param name="outputs">Receives the OpenXR paths in the order of
+    /// <paramref name="paths" />.</param>
+    /// <param name="workers">The maximum number of threads used for the
+    /// conversion, including the calling one.</param>
+    /// <exception cref="std::system_error">If any of the conversions failed.
+    /// </exception>
+    static inline void parse(_In_ const dispatch_table& table,
+            _In_reads_(cnt) const char *const *paths,
+            _In_ const std::size_t cnt,
+            _Out_writes_(cnt) XrPath *outputs,
+            _In_ const std::size_t workers = 1) {
+        detail::parse_paths(paths, cnt, outputs, workers,
+            [&table](const char *p) { return parse(table, p); });
+    }
+
+    /// <summary>
+    /// Parses a batch of OpenXR paths from their string representations
+    /// using the given cache.
+    /// </summary>
+    /// <remarks>
+    /// Each distinct string is converted only once, optionally using
+    /// multiple threads. Strings that are already in the cache are not
+    /// passed to the runtime at all.
+    /// </remarks>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="paths">The string representations of the paths.</param>
+    /// <param name="cnt">The number of elements in <paramref name="paths" />
+    /// and <paramref name="outputs" />.</param>
+    /// <param name="outputs">Receives the OpenXR paths in the order of
+    /// <paramref name="paths" />.</param>
+    /// <param name="workers">The maximum number of threads used for the
+    /// conversion, including the calling one.</param>
+    /// <exception cref="std::system_error">If any of the conversions failed.
+    /// </exception>
+    static inline void parse(_In_ path_cache& cache,
+            _In_reads_(cnt) const char *const *paths,
+            _In_ const std::size_t cnt,
+            _Out_writes_(cnt) XrPath *outputs,
+            _In_ const std::size_t workers = 1) {
+        detail::parse_paths(paths, cnt, outputs, workers,
+            [&cache](const char *p) { return cache.parse(p); });
+    }
+
+#if defined(__cpp_lib_span)
+    /// <summary>
+    /// Parses a batch of OpenXR paths from their string representations.
+    /// </summary>
+    /// <typeparam name="TContext">The type of the object performing the
+    /// conversion, which is an <see cref="XrInstance" />, a
+    /// <see cref="dispatch_table" /> or a <see cref="path_cache" />.
+    /// </typeparam>
+    /// <param name="context">The object performing the conversion.</param>
+    /// <param name="paths">The string representations of the paths.</param>
+    /// <param name="outputs">Receives the OpenXR paths in the order of
+    /// <paramref name="paths" />. This span must have the same size as
+    /// <paramref name="paths" />.</param>
+    /// <param name="workers">The maximum number of threads used for the
+    /// conversion, including the calling one.</param>
+    /// <exception cref="std::system_error">If any of the conversions failed.
+    /// </exception>
+    template<class TContext>
+    static inline void parse(_In_ TContext&& context,
+            _In_ const std::span<const char *const> paths,
+            _In_ const std::span<XrPath> outputs,
+            _In_ const std::size_t workers = 1) {
+        assert(paths.size() == outputs.size());
+        parse(std::forward<TContext>(context), paths.data(), paths.size(),
+            outputs.data(), workers);
+    }
+#endif /* defined(__cpp_lib_span) */
+
     /// <summary>
     /// Initialsies a new instance.
     /// </summary>
@@ -84,6 +351,69 @@ public:
     inline path(_In_ const unique_instance& instance, _In_z_ const char *path)
         : _path(parse(instance, path)) {}
 
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <exception cref="std::system_error">If the path could not be parsed from
+    /// the given input.</exception>
+    inline path(_In_ const dispatch_table& table, _In_z_ const char *path)
+        : _path(parse(table, path)) { }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    /// <exception cref="std::system_error">If the path could not be parsed from
+    /// the given input.</exception>
+    inline path(_In_ path_cache& cache, _In_z_ const char *path)
+        : _path(parse(cache, path)) { }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="path">The path literal, which has been created using the
+    /// <c>_xrpath</c> suffix.</param>
+    /// <exception cref="std::system_error">If the path could not be
+    /// resolved.</exception>
+    inline path(_In_ path_cache& cache, _In_ const path_literal& path)
+        : _path(parse(cache, path)) { }
+
+    /// <summary>
+    /// Initialises a new instance, handling failures as configured by the
+    /// given error policy.
+    /// </summary>
+    /// <remarks>
+    /// If the policy returns from a failure, the path will be empty.
+    /// </remarks>
+    /// <typeparam name="TErrorPolicy">The error policy, for instance
+    /// <see cref="log_error_policy" />.</typeparam>
+    /// <typeparam name="TContext">The type of the object performing the
+    /// conversion, which is an <see cref="XrInstance" />, a
+    /// <see cref="unique_instance" />, a <see cref="dispatch_table" /> or a
+    /// <see cref="path_cache" />.</typeparam>
+    /// <param name="policy">A tag selecting the error policy.</param>
+    /// <param name="context">The object performing the conversion.</param>
+    /// <param name="path">The string representation of the path.</param>
+    template<class TErrorPolicy, class TContext>
+    inline path(_In_ const TErrorPolicy& policy,
+            _In_ TContext&& context,
+            _In_z_ const char *path) : _path(XR_NULL_PATH) {
+        (void) policy;
+        auto retval = try_parse(std::forward<TContext>(context), path);
+        if (retval) {
+            this->_path = *retval;
+        } else {
+            TErrorPolicy::on_failure(retval.result(), path);
+        }
+    }
+
     /// <summary>
     /// Answer whether the path is invalid.
     /// </summary>
@@ -108,7 +438,8 @@ public:
             len,
             &len,
             retval));
-        return std::string(retval, retval + len);
+        // The length reported by the runtime includes the terminating null.
+        return std::string(retval, (len > 0) ? len - 1 : 0);
     }
 
     /// <summary>
@@ -121,6 +452,163 @@ public:
         return this->to_string(instance.get());
     }
 
+    /// <summary>
+    /// Convert the path back to its string representation.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <returns>The string representation of the path.</returns>
+    inline std::string to_string(_In_ const dispatch_table& table) {
+        assert(table);
+        std::uint32_t len = XR_MAX_PATH_LENGTH;
+        char retval[XR_MAX_PATH_LENGTH];
+        THROW_IF_XR_FAILED(table.xrPathToString(table.instance(),
+            this->_path,
+            len,
+            &len,
+            retval));
+        // The length reported by the runtime includes the terminating null.
+        return std::string(retval, (len > 0) ? len - 1 : 0);
+    }
+
+    /// <summary>
+    /// Convert the path back to its string representation.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion. If the path has been converted before, the
+    /// runtime will not be called.</param>
+    /// <returns>The string representation of the path.</returns>
+    inline std::string to_string(_In_ path_cache& cache) {
+        return cache.to_string(this->_path);
+    }
+
+    /// <summary>
+    /// Convert the path to its string representation in the given buffer.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="buffer">The buffer receiving the null-terminated string
+    /// representation of the path.</param>
+    /// <param name="cnt">The size of <paramref name="buffer" /> in characters.
+    /// A buffer of <c>XR_MAX_PATH_LENGTH</c> characters is always sufficient.
+    /// </param>
+    /// <returns>The length of the string representation, not including the
+    /// terminating null.</returns>
+    /// <exception cref="std::system_error">If the operation failed, including
+    /// the case that <paramref name="buffer" /> is too small.</exception>
+    inline std::size_t to_string(_In_ const XrInstance instance,
+            _Out_writes_(cnt) char *buffer,
+            _In_ const std::size_t cnt) const {
+        return this->try_to_string(instance, buffer, cnt).value();
+    }
+
+    /// <summary>
+    /// Convert the path to its string representation in the given buffer.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="buffer">The buffer receiving the null-terminated string
+    /// representation of the path.</param>
+    /// <param name="cnt">The size of <paramref name="buffer" /> in characters.
+    /// A buffer of <c>XR_MAX_PATH_LENGTH</c> characters is always sufficient.
+    /// </param>
+    /// <returns>The length of the string representation, not including the
+    /// terminating null.</returns>
+    /// <exception cref="std::system_error">If the operation failed, including
+    /// the case that <paramref name="buffer" /> is too small.</exception>
+    inline std::size_t to_string(_In_ const dispatch_table& table,
+            _Out_writes_(cnt) char *buffer,
+            _In_ const std::size_t cnt) const {
+        return this->try_to_string(table, buffer, cnt).value();
+    }
+
+    /// <summary>
+    /// Convert the path to its string representation in the given buffer
+    /// without throwing an exception if the operation fails.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="buffer">The buffer receiving the null-terminated string
+    /// representation of the path.</param>
+    /// <param name="cnt">The size of <paramref name="buffer" /> in characters.
+    /// </param>
+    /// <returns>The length of the string representation, not including the
+    /// terminating null, or the error code of the runtime.</returns>
+    inline expected<std::size_t> try_to_string(_In_ const XrInstance instance,
+            _Out_writes_(cnt) char *buffer,
+            _In_ const std::size_t cnt) const noexcept {
+        assert(instance != XR_NULL_HANDLE);
+        return convert(::xrPathToString, instance, this->_path, buffer, cnt);
+    }
+
+    /// <summary>
+    /// Convert the path to its string representation in the given buffer
+    /// without throwing an exception if the operation fails.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="buffer">The buffer receiving the null-terminated string
+    /// representation of the path.</param>
+    /// <param name="cnt">The size of <paramref name="buffer" /> in characters.
+    /// </param>
+    /// <returns>The length of the string representation, not including the
+    /// terminating null, or the error code of the runtime.</returns>
+    inline expected<std::size_t> try_to_string(_In_ const dispatch_table& table,
+            _Out_writes_(cnt) char *buffer,
+            _In_ const std::size_t cnt) const noexcept {
+        assert(table);
+        return convert(table.xrPathToString, table.instance(), this->_path,
+            buffer, cnt);
+    }
+
+    /// <summary>
+    /// Convert the path to a string allocated from the given memory resource.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance used to perform the
+    /// conversion.</param>
+    /// <param name="resource">The memory resource to allocate the string
+    /// from.</param>
+    /// <returns>The string representation of the path.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    inline std::pmr::string to_string(_In_ const XrInstance instance,
+            _In_ std::pmr::memory_resource *resource) const {
+        assert(resource != nullptr);
+        char buffer[XR_MAX_PATH_LENGTH];
+        auto len = this->to_string(instance, buffer, XR_MAX_PATH_LENGTH);
+        return std::pmr::string(buffer, len, resource);
+    }
+
+    /// <summary>
+    /// Convert the path to a string allocated from the given memory resource.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance used to
+    /// perform the conversion.</param>
+    /// <param name="resource">The memory resource to allocate the string
+    /// from.</param>
+    /// <returns>The string representation of the path.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    inline std::pmr::string to_string(_In_ const dispatch_table& table,
+            _In_ std::pmr::memory_resource *resource) const {
+        assert(resource != nullptr);
+        char buffer[XR_MAX_PATH_LENGTH];
+        auto len = this->to_string(table, buffer, XR_MAX_PATH_LENGTH);
+        return std::pmr::string(buffer, len, resource);
+    }
+
+    /// <summary>
+    /// Gets a view of the string representation of the path, which is owned
+    /// by the given cache.
+    /// </summary>
+    /// <param name="cache">The path cache of the OpenXR instance used to
+    /// perform the conversion. The string is retrieved from the runtime only
+    /// if the path has not been converted before.</param>
+    /// <returns>The string representation of the path, which remains valid
+    /// until the cache is cleared or destroyed.</returns>
+    /// <exception cref="std::system_error">If the operation failed.</exception>
+    inline std::string_view to_string_view(_In_ path_cache& cache) const {
+        return cache.to_string_view(this->_path);
+    }
+
     /// <summary>
     /// Gets the native <see cref="XrPath" />.
     /// </summary>
@@ -148,6 +636,31 @@ public:
 
 private:
 
+    /// <summary>
+    /// Converts <paramref name="path" /> using the given function.
+    /// </summary>
+    static inline expected<std::size_t> convert(
+            _In_ const PFN_xrPathToString path_to_string,
+            _In_ const XrInstance instance,
+            _In_ const XrPath path,
+            _Out_writes_(cnt) char *buffer,
+            _In_ const std::size_t cnt) noexcept {
+        assert(path_to_string != nullptr);
+        assert(buffer != nullptr);
+        std::uint32_t len = 0;
+        auto status = path_to_string(instance,
+            path,
+            static_cast<std::uint32_t>(cnt),
+            &len,
+            buffer);
+        if (XR_FAILED(status)) {
+            return status;
+        }
+
+        // The length reported by the runtime includes the terminating null.
+        return expected<std::size_t>((len > 0) ? len - 1 : 0, status);
+    }
+
     XrPath _path;
 };
 
@@ -0,0 +1,290 @@
+﻿// <copyright file="path_cache.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_PATH_CACHE_H)
+#define _XRTL_PATH_CACHE_H
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cinttypes>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/dispatch_table.h"
+#include "xrtl/expected.h"
+#include "xrtl/path_literal.h"
+#include "xrtl/result.h"
+#include "xrtl/unique_handle.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// An instance-scoped cache interning the string representations of
+/// <see cref="XrPath" />s.
+/// </summary>
+/// <remarks>
+/// <para>OpenXR paths are atoms that do not change during the lifetime of an
+/// instance, so the cache never needs to evict anything. Each string is
+/// converted by the runtime at most once (modulo races) and all subsequent
+/// lookups in both directions are served from the cache.</para>
+/// <para>The cache is safe to be used from multiple threads. Lookups only
+/// acquire a shared lock on one of the shards of the cache, so concurrent
+/// readers do not block each other.</para>
+/// <para>Path literals created using the <c>_xrpath</c> suffix are assigned
+/// a fixed slot in a lock-free table, which is located using the hash
+/// computed at compile time. Once the slot has been resolved, looking up the
+/// literal does not involve any hashing or locking.</para>
+/// <para>The cache is only valid as long as the instance it has been created
+/// for is alive.</para>
+/// </remarks>
+class path_cache final {
+
+public:
+
+    /// <summary>
+    /// Initialises a new instance for the given <paramref name="instance" />,
+    /// which will perform conversions via the loader.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to convert paths for.
+    /// </param>
+    explicit path_cache(_In_ const XrInstance instance) noexcept;
+
+    /// <summary>
+    /// Initialises a new instance for the given <paramref name="instance" />,
+    /// which will perform conversions via the loader.
+    /// </summary>
+    /// <param name="instance">The OpenXR instance to convert paths for.
+    /// </param>
+    inline explicit path_cache(_In_ const unique_instance& instance) noexcept
+        : path_cache(instance.get()) { }
+
+    /// <summary>
+    /// Initialises a new instance for the instance of the given
+    /// <paramref name="table" />, which will perform conversions without going
+    /// through the loader.
+    /// </summary>
+    /// <param name="table">The dispatch table of the OpenXR instance to
+    /// convert paths for.</param>
+    explicit path_cache(_In_ const dispatch_table& table) noexcept;
+
+    path_cache(const path_cache&) = delete;
+
+    /// <summary>
+    /// Removes all cached paths and resets the statistics.
+    /// </summary>
+    /// <remarks>
+    /// This method must not be called while other threads are using the
+    /// cache.
+    /// </remarks>
+    void clear(void);
+
+    /// <summary>
+    /// Answer how many lookups have been served from the cache.
+    /// </summary>
+    /// <remarks>
+    /// <para>The counters are kept per shard, so this method sums the
+    /// counters of all shards. The result is only exact if no other thread is
+    /// using the cache at the same time.</para>
+    /// <para>Lookups of path literals that have already been resolved in
+    /// their slot are not counted, such that they do not write to any memory
+    /// shared between threads.</para>
+    /// </remarks>
+    /// <returns>The number of cache hits.</returns>
+    std::uint64_t hits(void) const noexcept;
+
+    /// <summary>
+    /// Gets the instance the cache has been created for.
+    /// </summary>
+    /// <returns>The OpenXR instance.</returns>
+    inline XrInstance instance(void) const noexcept {
+        return this->_instance;
+    }
+
+    /// <summary>
+    /// Answer how many lookups required a call to the runtime.
+    /// </summary>
+    /// <remarks>
+    /// The counters are kept per shard, so this method sums the counters of
+    /// all shards. The result is only exact if no other thread is using the
+    /// cache at the same time.
+    /// </remarks>
+    /// <returns>The number of cache misses.</returns>
+    std::uint64_t misses(void) const noexcept;
+
+    /// <summary>
+    /// Gets the <see cref="XrPath" /> for the given string representation.
+    /// </summary>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string.</returns>
+    /// <exception cref="std::system_error">If the path was not in the cache
+    /// and the runtime failed to convert it.</exception>
+    inline XrPath parse(_In_ const std::string_view path) {
+        return this->try_parse(path).value();
+    }
+
+    /// <summary>
+    /// Gets the <see cref="XrPath" /> for the given path literal.
+    /// </summary>
+    /// <remarks>
+    /// The literal is resolved on first use and stored in a fixed slot of
+    /// the cache. If all slots are in use, the literal is looked up like any
+    /// other string.
+    /// </remarks>
+    /// <param name="path">The path literal to be resolved.</param>
+    /// <returns>The OpenXR path represented by the given literal.</returns>
+    /// <exception cref="std::system_error">If the path was not in the cache
+    /// and the runtime failed to convert it.</exception>
+    XrPath parse(_In_ const path_literal& path);
+
+    /// <summary>
+    /// Gets the string representation of the given <see cref="XrPath" />.
+    /// </summary>
+    /// <param name="path">The path to be converted.</param>
+    /// <returns>The string representation of the path.</returns>
+    /// <exception cref="std::system_error">If the path was not in the cache
+    /// and the runtime failed to convert it.</exception>
+    inline std::string to_string(_In_ const XrPath path) {
+        return std::string(this->to_string_view(path));
+    }
+
+    /// <summary>
+    /// Gets the string representation of the given <see cref="XrPath" />
+    /// without copying it.
+    /// </summary>
+    /// <param name="path">The path to be converted.</param>
+    /// <returns>A view of the string representation of the path, which
+    /// remains valid until the cache is cleared or destroyed.</returns>
+    /// <exception cref="std::system_error">If the path was not in the cache
+    /// and the runtime failed to convert it.</exception>
+    inline std::string_view to_string_view(_In_ const XrPath path) {
+        return this->try_to_string_view(path).value();
+    }
+
+    /// <summary>
+    /// Gets the <see cref="XrPath" /> for the given string representation
+    /// without throwing if the conversion fails.
+    /// </summary>
+    /// <param name="path">The string representation of the path.</param>
+    /// <returns>The OpenXR path represented by the given string or the error
+    /// code of the runtime.</returns>
+    expected<XrPath> try_parse(_In_ const std::string_view path);
+
+    /// <summary>
+    /// Gets the string representation of the given <see cref="XrPath" />
+    /// without copying it and without throwing if the conversion fails.
+    /// </summary>
+    /// <param name="path">The path to be converted.</param>
+    /// <returns>A view of the string representation of the path, which
+    /// remains valid until the cache is cleared or destroyed, or the error
+    /// code of the runtime.</returns>
+    expected<std::string_view> try_to_string_view(_In_ const XrPath path);
+
+    path_cache& operator =(const path_cache&) = delete;
+
+private:
+
+    /// <summary>
+    /// A slot of the lock-free table of path literals.
+    /// </summary>
+    /// <remarks>
+    /// The hash and the length of the literal are published after the
+    /// <c>key</c> has been claimed, which allows for rejecting colliding
+    /// literals without reading their characters. <c>hash</c> is zero while
+    /// the slot is being claimed, and <c>length</c> is only valid once
+    /// <c>hash</c> has been published.
+    /// </remarks>
+    struct literal_slot {
+        std::atomic<const char *> key;
+        std::atomic<std::uint64_t> hash;
+        std::size_t length;
+        std::atomic<XrPath> path;
+    };
+
+    /// <summary>
+    /// The number of slots for path literals, which must be a power of two.
+    /// </summary>
+    static constexpr std::size_t literals = 256;
+
+    static_assert((literals & (literals - 1)) == 0, "The number of literal "
+        "slots must be a power of two.");
+
+    /// <summary>
+    /// The assumed size of a cache line, which the shards are aligned to
+    /// such that threads working on different shards do not share a line.
+    /// </summary>
+    static constexpr std::size_t cache_line = 64;
+
+    /// <summary>
+    /// A shard of the forward (string to path) map.
+    /// </summary>
+    /// <remarks>
+    /// The statistics are counted per shard, because a single pair of
+    /// counters would be written by all threads and serialise concurrent
+    /// readers of different shards.
+    /// </remarks>
+    struct alignas(cache_line) path_shard {
+        std::shared_mutex lock;
+        std::unordered_map<std::string_view, XrPath> paths;
+        std::deque<std::string> strings;
+        std::atomic<std::uint64_t> hits { 0 };
+        std::atomic<std::uint64_t> misses { 0 };
+    };
+
+    /// <summary>
+    /// A shard of the reverse (path to string) map.
+    /// </summary>
+    struct alignas(cache_line) string_shard {
+        std::shared_mutex lock;
+        std::unordered_map<XrPath, std::string_view> strings;
+        std::atomic<std::uint64_t> hits { 0 };
+        std::atomic<std::uint64_t> misses { 0 };
+    };
+
+    /// <summary>
+    /// The number of shards, which must be a power of two.
+    /// </summary>
+    static constexpr std::size_t shards = 16;
+
+    static_assert((shards & (shards - 1)) == 0, "The number of shards must "
+        "be a power of two.");
+
+    /// <summary>
+    /// Adds the given mapping to both directions of the cache and answers
+    /// the string stored in the cache.
+    /// </summary>
+    std::string_view insert(_In_ const std::string_view string,
+        _In_ const XrPath path);
+
+    inline path_shard& path_shard_of(_In_ const std::size_t hash) noexcept {
+        return this->_paths[hash & (shards - 1)];
+    }
+
+    inline string_shard& string_shard_of(_In_ const XrPath path) noexcept {
+        return this->_strings[std::hash<XrPath>()(path) & (shards - 1)];
+    }
+
+    XrInstance _instance;
+    std::array<literal_slot, literals> _literals;
+    PFN_xrPathToString _path_to_string;
+    std::array<path_shard, shards> _paths;
+    PFN_xrStringToPath _string_to_path;
+    std::array<string_shard, shards> _strings;
+};
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/path_cache.inl"
+
+#endif /* !defined(_XRTL_PATH_CACHE_H) */
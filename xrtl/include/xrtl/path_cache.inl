@@ -0,0 +1,270 @@
+﻿// <copyright file="path_cache.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::path_cache
+ */
+inline XRTL_NAMESPACE::path_cache::path_cache(
+        _In_ const XrInstance instance) noexcept
+    : _instance(instance),
+        _path_to_string(::xrPathToString),
+        _string_to_path(::xrStringToPath) {
+    for (auto& s : this->_literals) {
+        s.key.store(nullptr, std::memory_order_relaxed);
+        s.hash.store(0, std::memory_order_relaxed);
+        s.length = 0;
+        s.path.store(XR_NULL_PATH, std::memory_order_relaxed);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::path_cache
+ */
+inline XRTL_NAMESPACE::path_cache::path_cache(
+        _In_ const dispatch_table& table) noexcept
+    : _instance(table.instance()),
+        _path_to_string(table.xrPathToString),
+        _string_to_path(table.xrStringToPath) {
+    for (auto& s : this->_literals) {
+        s.key.store(nullptr, std::memory_order_relaxed);
+        s.hash.store(0, std::memory_order_relaxed);
+        s.length = 0;
+        s.path.store(XR_NULL_PATH, std::memory_order_relaxed);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::clear
+ */
+inline void XRTL_NAMESPACE::path_cache::clear(void) {
+    for (auto& s : this->_literals) {
+        s.key.store(nullptr, std::memory_order_relaxed);
+        s.hash.store(0, std::memory_order_relaxed);
+        s.length = 0;
+        s.path.store(XR_NULL_PATH, std::memory_order_relaxed);
+    }
+
+    for (auto& s : this->_paths) {
+        std::unique_lock<std::shared_mutex> l(s.lock);
+        s.paths.clear();
+        s.strings.clear();
+        s.hits.store(0, std::memory_order_relaxed);
+        s.misses.store(0, std::memory_order_relaxed);
+    }
+
+    for (auto& s : this->_strings) {
+        std::unique_lock<std::shared_mutex> l(s.lock);
+        s.strings.clear();
+        s.hits.store(0, std::memory_order_relaxed);
+        s.misses.store(0, std::memory_order_relaxed);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::hits
+ */
+inline std::uint64_t XRTL_NAMESPACE::path_cache::hits(void) const noexcept {
+    std::uint64_t retval = 0;
+
+    for (auto& s : this->_paths) {
+        retval += s.hits.load(std::memory_order_relaxed);
+    }
+
+    for (auto& s : this->_strings) {
+        retval += s.hits.load(std::memory_order_relaxed);
+    }
+
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::misses
+ */
+inline std::uint64_t XRTL_NAMESPACE::path_cache::misses(
+        void) const noexcept {
+    std::uint64_t retval = 0;
+
+    for (auto& s : this->_paths) {
+        retval += s.misses.load(std::memory_order_relaxed);
+    }
+
+    for (auto& s : this->_strings) {
+        retval += s.misses.load(std::memory_order_relaxed);
+    }
+
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::try_parse
+ */
+inline XRTL_NAMESPACE::expected<XrPath>
+XRTL_NAMESPACE::path_cache::try_parse(_In_ const std::string_view path) {
+    assert(this->_instance != XR_NULL_HANDLE);
+    auto& shard = this->path_shard_of(std::hash<std::string_view>()(path));
+
+    {
+        std::shared_lock<std::shared_mutex> l(shard.lock);
+        auto it = shard.paths.find(path);
+        if (it != shard.paths.end()) {
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+
+    // The runtime requires a null-terminated string, which the view cannot
+    // guarantee, so we need to copy it here. This is also what we store in
+    // the cache once the runtime accepted the input.
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    const std::string string(path);
+    XrPath retval;
+    auto status = this->_string_to_path(this->_instance, string.c_str(),
+        &retval);
+    if (XR_FAILED(status)) {
+        return status;
+    }
+
+    this->insert(string, retval);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::parse
+ */
+inline XrPath XRTL_NAMESPACE::path_cache::parse(
+        _In_ const path_literal& path) {
+    auto index = static_cast<std::size_t>(path.hash()) & (literals - 1);
+
+    for (std::size_t i = 0; i < literals; ++i) {
+        auto& slot = this->_literals[index];
+        auto key = slot.key.load(std::memory_order_acquire);
+
+        if (key == nullptr) {
+            // Try to claim the free slot. If another thread was faster,
+            // 'key' receives its literal, which we check below.
+            if (slot.key.compare_exchange_strong(key, path.c_str(),
+                    std::memory_order_acq_rel)) {
+                slot.length = path.length();
+                slot.hash.store(path.hash(), std::memory_order_release);
+                key = path.c_str();
+            }
+        }
+
+        // Identical literals in different translation units are not
+        // guaranteed to be merged, so we need to compare the strings if the
+        // pointers are not the same. Hash and length reject colliding
+        // literals first. If they have not yet been published, we fall back
+        // to comparing the null-terminated key.
+        auto match = (key == path.c_str());
+        if (!match) {
+            const auto hash = slot.hash.load(std::memory_order_acquire);
+            if (hash == 0) {
+                match = (std::string_view(key) == path);
+            } else if ((hash == path.hash())
+                    && (slot.length == path.length())) {
+                match = (std::char_traits<char>::compare(key, path.c_str(),
+                    path.length()) == 0);
+            }
+        }
+
+        if (match) {
+            auto retval = slot.path.load(std::memory_order_acquire);
+
+            if (retval == XR_NULL_PATH) {
+                retval = this->parse(static_cast<std::string_view>(path));
+                slot.path.store(retval, std::memory_order_release);
+            }
+
+            return retval;
+        }
+
+        index = (index + 1) & (literals - 1);
+    }
+
+    // All slots are in use, so fall back to the map.
+    return this->parse(static_cast<std::string_view>(path));
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::insert
+ */
+inline std::string_view XRTL_NAMESPACE::path_cache::insert(
+        _In_ const std::string_view string,
+        _In_ const XrPath path) {
+    std::string_view retval;
+
+    {
+        auto& shard = this->path_shard_of(
+            std::hash<std::string_view>()(string));
+        std::unique_lock<std::shared_mutex> l(shard.lock);
+        auto it = shard.paths.find(string);
+        if (it != shard.paths.end()) {
+            // Another thread was faster, so we use its copy of the string.
+            retval = it->first;
+        } else {
+            // Note that std::deque does not move its elements if we append
+            // to it, so the view remains valid until the cache is cleared.
+            shard.strings.emplace_back(string);
+            retval = shard.strings.back();
+            shard.paths.emplace(retval, path);
+        }
+    }
+
+    {
+        auto& shard = this->string_shard_of(path);
+        std::unique_lock<std::shared_mutex> l(shard.lock);
+        shard.strings.emplace(path, retval);
+    }
+
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::path_cache::try_to_string_view
+ */
+inline XRTL_NAMESPACE::expected<std::string_view>
+XRTL_NAMESPACE::path_cache::try_to_string_view(_In_ const XrPath path) {
+    assert(this->_instance != XR_NULL_HANDLE);
+
+    auto& shard = this->string_shard_of(path);
+
+    {
+        std::shared_lock<std::shared_mutex> l(shard.lock);
+        auto it = shard.strings.find(path);
+        if (it != shard.strings.end()) {
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    std::uint32_t len = XR_MAX_PATH_LENGTH;
+    char string[XR_MAX_PATH_LENGTH];
+    auto status = this->_path_to_string(this->_instance,
+        path,
+        len,
+        &len,
+        string);
+    if (XR_FAILED(status)) {
+        return status;
+    }
+
+    // The length reported by the runtime includes the terminating null.
+    if ((len > 0) && (string[len - 1] == 0)) {
+        --len;
+    }
+
+    return this->insert(std::string_view(string, len), path);
+}
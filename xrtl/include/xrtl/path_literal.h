@@ -0,0 +1,229 @@
+﻿// <copyright file="path_literal.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_PATH_LITERAL_H)
+#define _XRTL_PATH_LITERAL_H
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Computes the 64-bit FNV-1a hash of the given string.
+/// </summary>
+/// <param name="str">The string to be hashed.</param>
+/// <param name="len">The length of <paramref name="str" /> in characters.
+/// </param>
+/// <returns>The hash of the string.</returns>
+constexpr std::uint64_t fnv1a(_In_reads_(len) const char *str,
+        _In_ const std::size_t len) noexcept {
+    std::uint64_t retval = 0xcbf29ce484222325ull;
+    for (std::size_t i = 0; i < len; ++i) {
+        retval ^= static_cast<std::uint8_t>(str[i]);
+        retval *= 0x100000001b3ull;
+    }
+    return retval;
+}
+
+/// <summary>
+/// Reports a malformed path literal via the default error policy.
+/// </summary>
+/// <remarks>
+/// This function is intentionally not <c>constexpr</c>, so reaching it
+/// during constant evaluation causes the compilation to fail.
+/// </remarks>
+/// <param name="message">A description of the problem.</param>
+inline void invalid_path(_In_z_ const char *message) {
+    default_error_policy::on_invalid_argument(message);
+}
+
+/// <summary>
+/// Checks whether the given string satisfies the grammar of OpenXR paths.
+/// </summary>
+/// <remarks>
+/// A well-formed path starts with a slash, consists of lower-case ASCII
+/// letters, digits, hyphens, underscores, periods and slashes, does not end
+/// with a slash, does not contain adjacent slashes and does not contain
+/// components consisting of periods only.
+/// </remarks>
+/// <param name="str">The string to be validated.</param>
+/// <param name="len">The length of <paramref name="str" /> in characters.
+/// </param>
+/// <returns><paramref name="len" />.</returns>
+/// <exception cref="std::invalid_argument">If the string is not a
+/// well-formed path and the default error policy throws. If evaluated in a
+/// constant expression, this causes the compilation to fail.</exception>
+constexpr std::size_t validate_path(_In_reads_(len) const char *str,
+        _In_ const std::size_t len) {
+    if ((len < 2) || (len >= XR_MAX_PATH_LENGTH)) {
+        invalid_path("The length of the path is invalid.");
+        return len;
+    }
+    if (str[0] != '/') {
+        invalid_path("A path must start with a slash.");
+        return len;
+    }
+    if (str[len - 1] == '/') {
+        invalid_path("A path must not end with a slash.");
+        return len;
+    }
+
+    bool periods_only = true;
+    for (std::size_t i = 1; i <= len; ++i) {
+        const auto c = (i < len) ? str[i] : '/';
+
+        if (c == '/') {
+            if (str[i - 1] == '/') {
+                invalid_path("A path must not contain adjacent slashes.");
+                return len;
+            }
+            if (periods_only) {
+                invalid_path("A path component must not consist of "
+                    "periods only.");
+                return len;
+            }
+            periods_only = true;
+
+        } else if (((c >= 'a') && (c <= 'z'))
+                || ((c >= '0') && (c <= '9'))
+                || (c == '-')
+                || (c == '_')) {
+            periods_only = false;
+
+        } else if (c != '.') {
+            invalid_path("A path must only contain lower-case "
+                "letters, digits, hyphens, underscores, periods and "
+                "slashes.");
+            return len;
+        }
+    }
+
+    return len;
+}
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+class path_literal;
+
+inline namespace literals {
+    constexpr path_literal operator ""_xrpath(_In_reads_(len) const char *str,
+        _In_ const std::size_t len);
+} /* inline namespace literals */
+
+
+/// <summary>
+/// The representation of an OpenXR path string literal, which is validated
+/// and hashed at compile time.
+/// </summary>
+/// <remarks>
+/// <para>Path literals are created using the <c>_xrpath</c> suffix. If the
+/// literal is used to initialise a <c>constexpr</c> variable, invalid paths
+/// are rejected by the compiler. Otherwise, the compiler may defer the
+/// validation to run time, in which case an invalid path is reported via the
+/// <see cref="default_error_policy" />.</para>
+/// <para>Path literals are resolved by <see cref="path_cache" />, which
+/// assigns each literal a fixed slot that is only resolved on first use.
+/// The cache keeps the string of the literal forever, which is why path
+/// literals can only be created from string literals, which have static
+/// storage duration.</para>
+/// </remarks>
+class path_literal final {
+
+public:
+
+    /// <summary>
+    /// Gets the null-terminated string representation of the path.
+    /// </summary>
+    /// <returns>The string representation of the path.</returns>
+    constexpr _Ret_z_ const char *c_str(void) const noexcept {
+        return this->_string;
+    }
+
+    /// <summary>
+    /// Gets the hash of the string representation of the path.
+    /// </summary>
+    /// <returns>The FNV-1a hash of the path.</returns>
+    constexpr std::uint64_t hash(void) const noexcept {
+        return this->_hash;
+    }
+
+    /// <summary>
+    /// Gets the length of the path in characters.
+    /// </summary>
+    /// <returns>The length of the path, not including the terminating null.
+    /// </returns>
+    constexpr std::size_t length(void) const noexcept {
+        return this->_length;
+    }
+
+    /// <summary>
+    /// Gets the string representation of the path.
+    /// </summary>
+    /// <returns>A view of the string representation.</returns>
+    constexpr operator std::string_view(void) const noexcept {
+        return std::string_view(this->_string, this->_length);
+    }
+
+private:
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="str">The string representation of the path, which must
+    /// have static storage duration.</param>
+    /// <param name="len">The length of <paramref name="str" /> in characters.
+    /// </param>
+    /// <exception cref="std::invalid_argument">If <paramref name="str" /> is
+    /// not a well-formed path.</exception>
+    constexpr path_literal(_In_reads_(len) const char *str,
+            _In_ const std::size_t len)
+        : _hash(detail::fnv1a(str, len)),
+        _length(detail::validate_path(str, len)),
+        _string(str) { }
+
+    std::uint64_t _hash;
+    std::size_t _length;
+    const char *_string;
+
+    friend constexpr path_literal literals::operator ""_xrpath(
+        _In_reads_(len) const char *str, _In_ const std::size_t len);
+};
+
+
+inline namespace literals {
+
+    /// <summary>
+    /// Creates a <see cref="path_literal" /> from a string literal.
+    /// </summary>
+    /// <param name="str">The string representation of the path.</param>
+    /// <param name="len">The length of <paramref name="str" /> in characters.
+    /// </param>
+    /// <returns>The validated and hashed path literal.</returns>
+    /// <exception cref="std::invalid_argument">If <paramref name="str" /> is
+    /// not a well-formed path.</exception>
+    constexpr path_literal operator ""_xrpath(_In_reads_(len) const char *str,
+            _In_ const std::size_t len) {
+        return path_literal(str, len);
+    }
+
+} /* inline namespace literals */
+
+XRTL_NAMESPACE_END
+
+#endif /* !defined(_XRTL_PATH_LITERAL_H) */
@@ -0,0 +1,687 @@
+﻿// <copyright file="pose.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_POSE_H)
+#define _XRTL_POSE_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/simd.h"
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Multiplies the quaternions <c>a</c> and <c>b</c>, each given as one vector
+/// per component holding multiple quaternions.
+/// </summary>
+inline void soa_multiply(_Out_ simd_vector& rx, _Out_ simd_vector& ry,
+        _Out_ simd_vector& rz, _Out_ simd_vector& rw,
+        _In_ const simd_vector ax, _In_ const simd_vector ay,
+        _In_ const simd_vector az, _In_ const simd_vector aw,
+        _In_ const simd_vector bx, _In_ const simd_vector by,
+        _In_ const simd_vector bz, _In_ const simd_vector bw) noexcept {
+    rx = simd_sub(simd_mul_add(aw, bx, simd_mul_add(ax, bw,
+        simd_mul(ay, bz))), simd_mul(az, by));
+    ry = simd_add(simd_mul_add(aw, by, simd_mul(ay, bw)),
+        simd_sub(simd_mul(az, bx), simd_mul(ax, bz)));
+    rz = simd_sub(simd_mul_add(aw, bz, simd_mul_add(ax, by,
+        simd_mul(az, bw))), simd_mul(ay, bx));
+    rw = simd_sub(simd_mul(aw, bw), simd_mul_add(ax, bx,
+        simd_mul_add(ay, by, simd_mul(az, bz))));
+}
+
+/// <summary>
+/// Rotates the vector <c>v</c> by the unit quaternion <c>q</c>, each given as
+/// one vector per component holding multiple elements.
+/// </summary>
+/// <remarks>
+/// This computes <c>v + w * t + cross(q, t)</c> with
+/// <c>t = 2 * cross(q, v)</c>, which requires fewer operations than two
+/// quaternion multiplications.
+/// </remarks>
+inline void soa_rotate(_Out_ simd_vector& rx, _Out_ simd_vector& ry,
+        _Out_ simd_vector& rz,
+        _In_ const simd_vector qx, _In_ const simd_vector qy,
+        _In_ const simd_vector qz, _In_ const simd_vector qw,
+        _In_ const simd_vector vx, _In_ const simd_vector vy,
+        _In_ const simd_vector vz) noexcept {
+    auto tx = simd_sub(simd_mul(qy, vz), simd_mul(qz, vy));
+    auto ty = simd_sub(simd_mul(qz, vx), simd_mul(qx, vz));
+    auto tz = simd_sub(simd_mul(qx, vy), simd_mul(qy, vx));
+    tx = simd_add(tx, tx);
+    ty = simd_add(ty, ty);
+    tz = simd_add(tz, tz);
+
+    rx = simd_add(simd_mul_add(qw, tx, vx),
+        simd_sub(simd_mul(qy, tz), simd_mul(qz, ty)));
+    ry = simd_add(simd_mul_add(qw, ty, vy),
+        simd_sub(simd_mul(qz, tx), simd_mul(qx, tz)));
+    rz = simd_add(simd_mul_add(qw, tz, vz),
+        simd_sub(simd_mul(qx, ty), simd_mul(qy, tx)));
+}
+
+/// <summary>
+/// Transforms the vectors by the upper 4x3 part of the given matrix, ie
+/// rotates them by the first three rows and adds the fourth row.
+/// </summary>
+template<bool NonTemporal>
+void transform_vectors(_In_ const simd_matrix& matrix,
+    _In_reads_(cnt) const XrVector3f *vectors,
+    _In_ const std::size_t cnt,
+    _Out_writes_(cnt) XrVector3f *result) noexcept;
+
+/// <summary>
+/// Four poses with one vector per component, ie each vector holds the same
+/// component of all four poses.
+/// </summary>
+struct soa_poses {
+    simd_vector qx, qy, qz, qw;
+    simd_vector px, py, pz;
+};
+
+/// <summary>
+/// Loads four poses and transposes them into a <see cref="soa_poses" />.
+/// </summary>
+soa_poses soa_load_poses(_In_reads_(4) const XrPosef *poses) noexcept;
+
+/// <summary>
+/// Transposes a <see cref="soa_poses" /> back and stores the four poses.
+/// </summary>
+void soa_store_poses(_Out_writes_(4) XrPosef *dst,
+    _In_ const soa_poses& poses) noexcept;
+
+/// <summary>
+/// Computes the normalised linear interpolation between the unit
+/// quaternions <c>a</c> and <c>b</c>, each given as one vector per component
+/// holding multiple quaternions.
+/// </summary>
+inline void soa_nlerp(_Out_ simd_vector& rx, _Out_ simd_vector& ry,
+        _Out_ simd_vector& rz, _Out_ simd_vector& rw,
+        _In_ const simd_vector ax, _In_ const simd_vector ay,
+        _In_ const simd_vector az, _In_ const simd_vector aw,
+        _In_ const simd_vector bx, _In_ const simd_vector by,
+        _In_ const simd_vector bz, _In_ const simd_vector bw,
+        _In_ const simd_vector t) noexcept {
+    // Follow the shorter arc by negating b if the angle is obtuse.
+    const auto c = simd_mul_add(ax, bx, simd_mul_add(ay, by,
+        simd_mul_add(az, bz, simd_mul(aw, bw))));
+    rx = simd_mul_add(t, simd_sub(simd_flip_sign(bx, c), ax), ax);
+    ry = simd_mul_add(t, simd_sub(simd_flip_sign(by, c), ay), ay);
+    rz = simd_mul_add(t, simd_sub(simd_flip_sign(bz, c), az), az);
+    rw = simd_mul_add(t, simd_sub(simd_flip_sign(bw, c), aw), aw);
+
+    const auto n = simd_reciprocal_sqrt(simd_mul_add(rx, rx,
+        simd_mul_add(ry, ry, simd_mul_add(rz, rz, simd_mul(rw, rw)))));
+    rx = simd_mul(rx, n);
+    ry = simd_mul(ry, n);
+    rz = simd_mul(rz, n);
+    rw = simd_mul(rw, n);
+}
+
+/// <summary>
+/// Computes the spherical linear interpolation between the unit quaternions
+/// <c>a</c> and <c>b</c>, each given as one vector per component holding
+/// multiple quaternions.
+/// </summary>
+/// <remarks>
+/// This evaluates the weights <c>sin((1 - t) * angle) / sin(angle)</c> and
+/// <c>sin(t * angle) / sin(angle)</c> using the polynomial approximation
+/// from D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP",
+/// which only requires multiplications and additions. For <c>t</c> within
+/// [0, 1], the error is in the order of <c>1e-5</c>, which is only reached
+/// for rotations close to 180 degrees.
+/// </remarks>
+inline void soa_slerp(_Out_ simd_vector& rx, _Out_ simd_vector& ry,
+        _Out_ simd_vector& rz, _Out_ simd_vector& rw,
+        _In_ const simd_vector ax, _In_ const simd_vector ay,
+        _In_ const simd_vector az, _In_ const simd_vector aw,
+        _In_ const simd_vector bx, _In_ const simd_vector by,
+        _In_ const simd_vector bz, _In_ const simd_vector bw,
+        _In_ const simd_vector t) noexcept {
+    constexpr float mu = 1.85298109240830f;
+    constexpr float u[] = { 1.0f / 3.0f, 1.0f / 10.0f, 1.0f / 21.0f,
+        1.0f / 36.0f, 1.0f / 55.0f, 1.0f / 78.0f, 1.0f / 105.0f,
+        mu / 136.0f };
+    constexpr float v[] = { 1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f,
+        4.0f / 9.0f, 5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f,
+        mu * 8.0f / 17.0f };
+
+    // Follow the shorter arc by negating b if the angle is obtuse.
+    const auto c = simd_mul_add(ax, bx, simd_mul_add(ay, by,
+        simd_mul_add(az, bz, simd_mul(aw, bw))));
+    const auto one = simd_splat(1.0f);
+    const auto x = simd_sub(simd_flip_sign(c, c), one);
+    const auto d = simd_sub(one, t);
+    const auto tt = simd_mul(t, t);
+    const auto dd = simd_mul(d, d);
+
+    auto wa = one;
+    auto wb = one;
+    for (std::size_t i = sizeof(u) / sizeof(*u); i-- > 0;) {
+        const auto ui = simd_splat(u[i]);
+        const auto vi = simd_splat(v[i]);
+        wa = simd_mul_add(simd_mul(simd_sub(simd_mul(ui, dd), vi), x), wa,
+            one);
+        wb = simd_mul_add(simd_mul(simd_sub(simd_mul(ui, tt), vi), x), wb,
+            one);
+    }
+    wa = simd_mul(wa, d);
+    wb = simd_flip_sign(simd_mul(wb, t), c);
+
+    rx = simd_mul_add(wb, bx, simd_mul(wa, ax));
+    ry = simd_mul_add(wb, by, simd_mul(wa, ay));
+    rz = simd_mul_add(wb, bz, simd_mul(wa, az));
+    rw = simd_mul_add(wb, bw, simd_mul(wa, aw));
+}
+
+/// <summary>
+/// Interpolates between two arrays of poses four at a time.
+/// </summary>
+template<bool Slerp>
+void interpolate_poses(_In_reads_(cnt) const XrPosef *from,
+    _In_reads_(cnt) const XrPosef *to,
+    _In_ const std::size_t cnt,
+    _In_ const float t,
+    _Out_writes_(cnt) XrPosef *result) noexcept;
+
+/// <summary>
+/// Extrapolates an array of poses from their velocities four at a time.
+/// </summary>
+/// <typeparam name="TVelocity">Either <c>XrSpaceVelocity</c> or
+/// <c>XrSpaceVelocityData</c>.</typeparam>
+template<class TVelocity>
+void extrapolate_poses(_In_reads_(cnt) const XrPosef *poses,
+    _In_reads_(cnt) const TVelocity *velocities,
+    _In_ const std::size_t cnt,
+    _In_ const float dt,
+    _Out_writes_(cnt) XrPosef *result) noexcept;
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Multiplies two quaternions, which yields the rotation that first applies
+/// <paramref name="rhs" /> and then <paramref name="lhs" />.
+/// </summary>
+/// <param name="lhs">The left-hand side operand.</param>
+/// <param name="rhs">The right-hand side operand.</param>
+/// <returns>The product <c>lhs * rhs</c>.</returns>
+XrQuaternionf multiply(_In_ const XrQuaternionf& lhs,
+    _In_ const XrQuaternionf& rhs) noexcept;
+
+/// <summary>
+/// Inverts a unit quaternion.
+/// </summary>
+/// <param name="q">The quaternion to be inverted, which must be of unit
+/// length.</param>
+/// <returns>The conjugate of <paramref name="q" />, which is its inverse.
+/// </returns>
+inline XrQuaternionf invert(_In_ const XrQuaternionf& q) noexcept {
+    return XrQuaternionf { -q.x, -q.y, -q.z, q.w };
+}
+
+/// <summary>
+/// Rotates a vector by a unit quaternion.
+/// </summary>
+/// <remarks>
+/// This computes <c>v + w * t + cross(q, t)</c> with
+/// <c>t = 2 * cross(q, v)</c>, which requires fewer operations than two
+/// quaternion multiplications or the conversion into a matrix.
+/// </remarks>
+/// <param name="q">The rotation, which must be a unit quaternion.</param>
+/// <param name="v">The vector to be rotated.</param>
+/// <returns>The rotated vector.</returns>
+XrVector3f rotate(_In_ const XrQuaternionf& q,
+    _In_ const XrVector3f& v) noexcept;
+
+/// <summary>
+/// Combines two poses such that the result transforms from the space of
+/// <paramref name="rhs" /> into the space <paramref name="lhs" /> is relative
+/// to.
+/// </summary>
+/// <remarks>
+/// <para>This is equivalent to multiplying the matrices of the poses, but
+/// requires about a third of the arithmetic operations of converting both
+/// poses and multiplying the 4x4 matrices.</para>
+/// <para>The orientations of the poses must be unit quaternions.</para>
+/// </remarks>
+/// <param name="lhs">The outer pose, for instance the pose of a tracking
+/// space.</param>
+/// <param name="rhs">The inner pose, which is relative to the space described
+/// by <paramref name="lhs" />.</param>
+/// <returns>The composed pose.</returns>
+XrPosef compose(_In_ const XrPosef& lhs, _In_ const XrPosef& rhs) noexcept;
+
+/// <summary>
+/// Inverts a pose.
+/// </summary>
+/// <param name="pose">The pose to be inverted, whose orientation must be a
+/// unit quaternion.</param>
+/// <returns>The inverse pose, which transforms into the space described by
+/// <paramref name="pose" />.</returns>
+XrPosef invert(_In_ const XrPosef& pose) noexcept;
+
+/// <summary>
+/// Computes the pose of <paramref name="pose" /> relative to
+/// <paramref name="base" />, for instance the pose of a controller relative
+/// to the head.
+/// </summary>
+/// <remarks>
+/// This is equivalent to <c>compose(invert(base), pose)</c>, but does not
+/// construct the intermediate inverse.
+/// </remarks>
+/// <param name="base">The pose the result should be relative to.</param>
+/// <param name="pose">The pose to be expressed relative to
+/// <paramref name="base" />. Both poses must be relative to the same space.
+/// </param>
+/// <returns>The relative pose.</returns>
+XrPosef relative_pose(_In_ const XrPosef& base,
+    _In_ const XrPosef& pose) noexcept;
+
+/// <summary>
+/// Transforms a point from the space described by a pose into the space the
+/// pose is relative to.
+/// </summary>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="point">The point to be transformed.</param>
+/// <returns>The transformed point.</returns>
+XrVector3f transform_point(_In_ const XrPosef& pose,
+    _In_ const XrVector3f& point) noexcept;
+
+/// <summary>
+/// Transforms a direction from the space described by a pose into the space
+/// the pose is relative to, which only applies the orientation.
+/// </summary>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="direction">The direction to be transformed.</param>
+/// <returns>The transformed direction.</returns>
+inline XrVector3f transform_direction(_In_ const XrPosef& pose,
+        _In_ const XrVector3f& direction) noexcept {
+    return rotate(pose.orientation, direction);
+}
+
+/// <summary>
+/// Transforms a batch of points by a matrix derived from a pose, for
+/// instance by <see cref="load_simd_matrix" /> or by multiplying such
+/// matrices.
+/// </summary>
+/// <remarks>
+/// <para>The matrix is assumed to be affine, ie the last column is ignored.
+/// </para>
+/// <para>If a SIMD backend is available, four points, or eight points if AVX
+/// is available, are loaded at once and transposed such that each
+/// instruction works on the same component of all of them. The remaining
+/// points are transformed one by one.</para>
+/// <para><paramref name="result" /> may be the same as
+/// <paramref name="points" />.</para>
+/// </remarks>
+/// <param name="matrix">The matrix describing the transformation.</param>
+/// <param name="points">The points to be transformed.</param>
+/// <param name="cnt">The number of elements in <paramref name="points" />
+/// and <paramref name="result" />.</param>
+/// <param name="result">Receives the transformed points.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+void transform_points(_In_ const simd_matrix& matrix,
+    _In_reads_(cnt) const XrVector3f *points,
+    _In_ const std::size_t cnt,
+    _Out_writes_(cnt) XrVector3f *result,
+    _In_ const store_hint hint = store_hint::cached) noexcept;
+
+/// <summary>
+/// Transforms a batch of points from the space described by a pose into the
+/// space the pose is relative to.
+/// </summary>
+/// <remarks>
+/// <para>The orientation is converted into a rotation matrix once, which
+/// requires fewer operations per point than rotating by the quaternion.
+/// The points are then transformed as by the overload accepting a
+/// <see cref="simd_matrix" />.</para>
+/// <para><paramref name="result" /> may be the same as
+/// <paramref name="points" />.</para>
+/// </remarks>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="points">The points to be transformed.</param>
+/// <param name="cnt">The number of elements in <paramref name="points" />
+/// and <paramref name="result" />.</param>
+/// <param name="result">Receives the transformed points.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+void transform_points(_In_ const XrPosef& pose,
+    _In_reads_(cnt) const XrVector3f *points,
+    _In_ const std::size_t cnt,
+    _Out_writes_(cnt) XrVector3f *result,
+    _In_ const store_hint hint = store_hint::cached) noexcept;
+
+/// <summary>
+/// Transforms a batch of directions from the space described by a pose into
+/// the space the pose is relative to, which only applies the orientation.
+/// </summary>
+/// <remarks>
+/// <paramref name="result" /> may be the same as
+/// <paramref name="directions" />.
+/// </remarks>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="directions">The directions to be transformed.</param>
+/// <param name="cnt">The number of elements in
+/// <paramref name="directions" /> and <paramref name="result" />.</param>
+/// <param name="result">Receives the transformed directions.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+void transform_directions(_In_ const XrPosef& pose,
+    _In_reads_(cnt) const XrVector3f *directions,
+    _In_ const std::size_t cnt,
+    _Out_writes_(cnt) XrVector3f *result,
+    _In_ const store_hint hint = store_hint::cached) noexcept;
+
+
+/// <summary>
+/// Determines how orientations are interpolated.
+/// </summary>
+enum class interpolation {
+
+    /// <summary>
+    /// Normalised linear interpolation, which is the cheapest method, but
+    /// does not rotate with constant angular velocity. The difference to
+    /// <see cref="slerp" /> is negligible for small angles like the ones
+    /// between consecutive tracking samples.
+    /// </summary>
+    nlerp,
+
+    /// <summary>
+    /// Spherical linear interpolation, which rotates with constant angular
+    /// velocity.
+    /// </summary>
+    slerp
+};
+
+/// <summary>
+/// Computes the normalised linear interpolation between two unit
+/// quaternions along the shorter arc.
+/// </summary>
+/// <param name="q0">The orientation at <paramref name="t" /> = 0.</param>
+/// <param name="q1">The orientation at <paramref name="t" /> = 1.</param>
+/// <param name="t">The interpolation parameter within [0, 1].</param>
+/// <returns>The interpolated unit quaternion.</returns>
+XrQuaternionf nlerp(_In_ const XrQuaternionf& q0,
+    _In_ const XrQuaternionf& q1,
+    _In_ const float t) noexcept;
+
+/// <summary>
+/// Computes the spherical linear interpolation between two unit quaternions
+/// along the shorter arc.
+/// </summary>
+/// <remarks>
+/// The interpolation is evaluated using a polynomial approximation, which
+/// does not require trigonometric functions. Its error is in the order of
+/// <c>1e-5</c> for <paramref name="t" /> within [0, 1] and decreases
+/// rapidly for smaller angles between the quaternions.
+/// </remarks>
+/// <param name="q0">The orientation at <paramref name="t" /> = 0.</param>
+/// <param name="q1">The orientation at <paramref name="t" /> = 1.</param>
+/// <param name="t">The interpolation parameter within [0, 1].</param>
+/// <returns>The interpolated unit quaternion.</returns>
+XrQuaternionf slerp(_In_ const XrQuaternionf& q0,
+    _In_ const XrQuaternionf& q1,
+    _In_ const float t) noexcept;
+
+/// <summary>
+/// Interpolates between two poses, for instance between the results of
+/// two calls to <c>xrLocateSpace</c>.
+/// </summary>
+/// <remarks>
+/// The position is interpolated linearly and the orientation as determined
+/// by <paramref name="method" />. If the poses were located at the times
+/// <c>t0</c> and <c>t1</c>, the pose at <c>time</c> is obtained for
+/// <c>t = (time - t0) / (t1 - t0)</c>.
+/// </remarks>
+/// <param name="from">The pose at <paramref name="t" /> = 0.</param>
+/// <param name="to">The pose at <paramref name="t" /> = 1.</param>
+/// <param name="t">The interpolation parameter within [0, 1].</param>
+/// <param name="method">The interpolation of the orientation.</param>
+/// <returns>The interpolated pose.</returns>
+XrPosef interpolate(_In_ const XrPosef& from,
+    _In_ const XrPosef& to,
+    _In_ const float t,
+    _In_ const interpolation method = interpolation::slerp) noexcept;
+
+/// <summary>
+/// Interpolates between two batches of poses, for instance the joints of a
+/// hand located at two different times.
+/// </summary>
+/// <remarks>
+/// <para>Four poses are loaded at once and transposed such that each
+/// instruction works on the same component of all of them.</para>
+/// <para><paramref name="result" /> may be the same as
+/// <paramref name="from" /> or <paramref name="to" />.</para>
+/// </remarks>
+/// <param name="from">The poses at <paramref name="t" /> = 0.</param>
+/// <param name="to">The poses at <paramref name="t" /> = 1.</param>
+/// <param name="cnt">The number of elements in <paramref name="from" />,
+/// <paramref name="to" /> and <paramref name="result" />.</param>
+/// <param name="t">The interpolation parameter within [0, 1].</param>
+/// <param name="result">Receives the interpolated poses.</param>
+/// <param name="method">The interpolation of the orientations.</param>
+void interpolate(_In_reads_(cnt) const XrPosef *from,
+    _In_reads_(cnt) const XrPosef *to,
+    _In_ const std::size_t cnt,
+    _In_ const float t,
+    _Out_writes_(cnt) XrPosef *result,
+    _In_ const interpolation method = interpolation::slerp) noexcept;
+
+/// <summary>
+/// Predicts a pose from its velocity, for instance for a time slightly
+/// after the one it was located at.
+/// </summary>
+/// <remarks>
+/// <para>The position moves with the linear velocity and the orientation
+/// rotates with the angular velocity, both of which are expressed in the
+/// space the pose is relative to. Velocities that are not marked valid in
+/// <c>velocityFlags</c> are treated as zero.</para>
+/// <para>The rotation is evaluated using a polynomial approximation, which
+/// is accurate as long as the rotation within <paramref name="dt" /> does
+/// not exceed one full turn.</para>
+/// </remarks>
+/// <param name="pose">The pose at the time it was located.</param>
+/// <param name="velocity">The velocity of the pose.</param>
+/// <param name="dt">The time to extrapolate in seconds, which can be
+/// negative. For <c>XrTime</c> values, which are in nanoseconds, this is
+/// <c>(time - location_time) * 1e-9f</c>.</param>
+/// <returns>The extrapolated pose.</returns>
+XrPosef extrapolate(_In_ const XrPosef& pose,
+    _In_ const XrSpaceVelocity& velocity,
+    _In_ const float dt) noexcept;
+
+/// <summary>
+/// Predicts a batch of poses from their velocities.
+/// </summary>
+/// <remarks>
+/// <para>Four poses are loaded at once and transposed such that each
+/// instruction works on the same component of all of them. The poses are
+/// extrapolated as described for the overload for a single pose.</para>
+/// <para><paramref name="result" /> may be the same as
+/// <paramref name="poses" />.</para>
+/// </remarks>
+/// <param name="poses">The poses at the time they were located.</param>
+/// <param name="velocities">The velocities of the poses.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" />,
+/// <paramref name="velocities" /> and <paramref name="result" />.</param>
+/// <param name="dt">The time to extrapolate in seconds.</param>
+/// <param name="result">Receives the extrapolated poses.</param>
+void extrapolate(_In_reads_(cnt) const XrPosef *poses,
+    _In_reads_(cnt) const XrSpaceVelocity *velocities,
+    _In_ const std::size_t cnt,
+    _In_ const float dt,
+    _Out_writes_(cnt) XrPosef *result) noexcept;
+
+#if defined(XR_VERSION_1_1)
+/// <summary>
+/// Predicts a pose from its velocity as returned by <c>xrLocateSpaces</c>.
+/// </summary>
+/// <param name="pose">The pose at the time it was located.</param>
+/// <param name="velocity">The velocity of the pose.</param>
+/// <param name="dt">The time to extrapolate in seconds.</param>
+/// <returns>The extrapolated pose.</returns>
+XrPosef extrapolate(_In_ const XrPosef& pose,
+    _In_ const XrSpaceVelocityData& velocity,
+    _In_ const float dt) noexcept;
+
+/// <summary>
+/// Predicts a batch of poses from their velocities as returned by
+/// <c>xrLocateSpaces</c>.
+/// </summary>
+/// <param name="poses">The poses at the time they were located.</param>
+/// <param name="velocities">The velocities of the poses.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" />,
+/// <paramref name="velocities" /> and <paramref name="result" />.</param>
+/// <param name="dt">The time to extrapolate in seconds.</param>
+/// <param name="result">Receives the extrapolated poses.</param>
+void extrapolate(_In_reads_(cnt) const XrPosef *poses,
+    _In_reads_(cnt) const XrSpaceVelocityData *velocities,
+    _In_ const std::size_t cnt,
+    _In_ const float dt,
+    _Out_writes_(cnt) XrPosef *result) noexcept;
+#endif /* defined(XR_VERSION_1_1) */
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Transforms a batch of points by a matrix derived from a pose.
+/// </summary>
+/// <param name="matrix">The matrix describing the transformation.</param>
+/// <param name="points">The points to be transformed.</param>
+/// <param name="result">Receives the transformed points. This span must have
+/// the same size as <paramref name="points" />.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+inline void transform_points(_In_ const simd_matrix& matrix,
+        _In_ const std::span<const XrVector3f> points,
+        _In_ const std::span<XrVector3f> result,
+        _In_ const store_hint hint = store_hint::cached) noexcept {
+    assert(points.size() == result.size());
+    transform_points(matrix, points.data(), points.size(), result.data(),
+        hint);
+}
+
+/// <summary>
+/// Transforms a batch of points from the space described by a pose into the
+/// space the pose is relative to.
+/// </summary>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="points">The points to be transformed.</param>
+/// <param name="result">Receives the transformed points. This span must have
+/// the same size as <paramref name="points" />.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+inline void transform_points(_In_ const XrPosef& pose,
+        _In_ const std::span<const XrVector3f> points,
+        _In_ const std::span<XrVector3f> result,
+        _In_ const store_hint hint = store_hint::cached) noexcept {
+    assert(points.size() == result.size());
+    transform_points(pose, points.data(), points.size(), result.data(),
+        hint);
+}
+
+/// <summary>
+/// Transforms a batch of directions from the space described by a pose into
+/// the space the pose is relative to.
+/// </summary>
+/// <param name="pose">The pose describing the transformation.</param>
+/// <param name="directions">The directions to be transformed.</param>
+/// <param name="result">Receives the transformed directions. This span must
+/// have the same size as <paramref name="directions" />.</param>
+/// <param name="hint">Determines whether the results are written through
+/// the cache, which is the default, or with non-temporal stores.</param>
+inline void transform_directions(_In_ const XrPosef& pose,
+        _In_ const std::span<const XrVector3f> directions,
+        _In_ const std::span<XrVector3f> result,
+        _In_ const store_hint hint = store_hint::cached) noexcept {
+    assert(directions.size() == result.size());
+    transform_directions(pose, directions.data(), directions.size(),
+        result.data(), hint);
+}
+
+/// <summary>
+/// Interpolates between two batches of poses.
+/// </summary>
+/// <param name="from">The poses at <paramref name="t" /> = 0.</param>
+/// <param name="to">The poses at <paramref name="t" /> = 1. This span must
+/// have the same size as <paramref name="from" />.</param>
+/// <param name="t">The interpolation parameter within [0, 1].</param>
+/// <param name="result">Receives the interpolated poses. This span must
+/// have the same size as <paramref name="from" />.</param>
+/// <param name="method">The interpolation of the orientations.</param>
+inline void interpolate(_In_ const std::span<const XrPosef> from,
+        _In_ const std::span<const XrPosef> to,
+        _In_ const float t,
+        _In_ const std::span<XrPosef> result,
+        _In_ const interpolation method = interpolation::slerp) noexcept {
+    assert(from.size() == to.size());
+    assert(from.size() == result.size());
+    interpolate(from.data(), to.data(), from.size(), t, result.data(),
+        method);
+}
+
+/// <summary>
+/// Predicts a batch of poses from their velocities.
+/// </summary>
+/// <param name="poses">The poses at the time they were located.</param>
+/// <param name="velocities">The velocities of the poses. This span must
+/// have the same size as <paramref name="poses" />.</param>
+/// <param name="dt">The time to extrapolate in seconds.</param>
+/// <param name="result">Receives the extrapolated poses. This span must
+/// have the same size as <paramref name="poses" />.</param>
+inline void extrapolate(_In_ const std::span<const XrPosef> poses,
+        _In_ const std::span<const XrSpaceVelocity> velocities,
+        _In_ const float dt,
+        _In_ const std::span<XrPosef> result) noexcept {
+    assert(poses.size() == velocities.size());
+    assert(poses.size() == result.size());
+    extrapolate(poses.data(), velocities.data(), poses.size(), dt,
+        result.data());
+}
+
+#if defined(XR_VERSION_1_1)
+/// <summary>
+/// Predicts a batch of poses from their velocities as returned by
+/// <c>xrLocateSpaces</c>.
+/// </summary>
+/// <param name="poses">The poses at the time they were located.</param>
+/// <param name="velocities">The velocities of the poses. This span must
+/// have the same size as <paramref name="poses" />.</param>
+/// <param name="dt">The time to extrapolate in seconds.</param>
+/// <param name="result">Receives the extrapolated poses. This span must
+/// have the same size as <paramref name="poses" />.</param>
+inline void extrapolate(_In_ const std::span<const XrPosef> poses,
+        _In_ const std::span<const XrSpaceVelocityData> velocities,
+        _In_ const float dt,
+        _In_ const std::span<XrPosef> result) noexcept {
+    assert(poses.size() == velocities.size());
+    assert(poses.size() == result.size());
+    extrapolate(poses.data(), velocities.data(), poses.size(), dt,
+        result.data());
+}
+#endif /* defined(XR_VERSION_1_1) */
+#endif /* defined(__cpp_lib_span) */
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/pose.inl"
+
+#endif /* !defined(_XRTL_POSE_H) */
@@ -0,0 +1,632 @@
+﻿// <copyright file="pose.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_DETAIL_NAMESPACE::transform_vectors
+ */
+template<bool NonTemporal>
+void XRTL_DETAIL_NAMESPACE::transform_vectors(
+        _In_ const simd_matrix& matrix,
+        _In_reads_(cnt) const XrVector3f *vectors,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) XrVector3f *result) noexcept {
+    assert((vectors != nullptr) || (cnt == 0));
+    assert((result != nullptr) || (cnt == 0));
+    if (cnt < 1) {
+        return;
+    }
+
+    // The vectors are tightly packed floats, which is asserted by
+    // simd_floats, so the arrays can be processed as arrays of floats. The
+    // input of each block is read before its output is written, so the
+    // operation can be performed in place.
+    auto src = simd_floats<XrVector3f, 3>(*vectors);
+    auto dst = simd_floats<XrVector3f, 3>(*result);
+    std::size_t i = 0;
+
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    // A single vector is the weighted sum of the rows.
+    const auto transform_one = [&matrix](const float *s, float *d) {
+        simd_store3(d, simd_mul_add(simd_splat(s[2]), matrix.r[2],
+            simd_mul_add(simd_splat(s[1]), matrix.r[1],
+            simd_mul_add(simd_splat(s[0]), matrix.r[0], matrix.r[3]))));
+    };
+
+    if (NonTemporal) {
+        // Non-temporal stores require aligned output. As the vectors are
+        // twelve bytes, the offset changes by four bytes with every vector
+        // until the output is aligned.
+#if XRTL_SIMD_AVX
+        constexpr std::uintptr_t alignment = 32;
+#else /* XRTL_SIMD_AVX */
+        constexpr std::uintptr_t alignment = 16;
+#endif /* XRTL_SIMD_AVX */
+        for (; (i < cnt) && (reinterpret_cast<std::uintptr_t>(dst + 3 * i)
+                % alignment != 0); ++i) {
+            transform_one(src + 3 * i, dst + 3 * i);
+        }
+    }
+
+    // For blocks of multiple vectors, the elements of the matrix are
+    // splatted once, and the vectors are transposed such that each
+    // instruction processes one component of all of them.
+    float m[16];
+    store_simd_matrix(m, matrix);
+
+#if XRTL_SIMD_AVX
+    {
+        simd_vector8 e[12];
+        for (std::size_t j = 0; j < 12; ++j) {
+            e[j] = simd_splat8(m[4 * (j / 3) + j % 3]);
+        }
+
+        for (; i + 8 <= cnt; i += 8) {
+            simd_vector8 x, y, z;
+            simd_load3x8(src + 3 * i, x, y, z);
+            const auto rx = simd_mul_add8(z, e[6],
+                simd_mul_add8(y, e[3], simd_mul_add8(x, e[0], e[9])));
+            const auto ry = simd_mul_add8(z, e[7],
+                simd_mul_add8(y, e[4], simd_mul_add8(x, e[1], e[10])));
+            const auto rz = simd_mul_add8(z, e[8],
+                simd_mul_add8(y, e[5], simd_mul_add8(x, e[2], e[11])));
+            simd_store3x8<NonTemporal>(dst + 3 * i, rx, ry, rz);
+        }
+    }
+#endif /* XRTL_SIMD_AVX */
+
+    {
+        simd_vector e[12];
+        for (std::size_t j = 0; j < 12; ++j) {
+            e[j] = simd_splat(m[4 * (j / 3) + j % 3]);
+        }
+
+        for (; i + 4 <= cnt; i += 4) {
+            simd_vector x, y, z;
+            simd_load3x4(src + 3 * i, x, y, z);
+            const auto rx = simd_mul_add(z, e[6],
+                simd_mul_add(y, e[3], simd_mul_add(x, e[0], e[9])));
+            const auto ry = simd_mul_add(z, e[7],
+                simd_mul_add(y, e[4], simd_mul_add(x, e[1], e[10])));
+            const auto rz = simd_mul_add(z, e[8],
+                simd_mul_add(y, e[5], simd_mul_add(x, e[2], e[11])));
+            simd_store3x4<NonTemporal>(dst + 3 * i, rx, ry, rz);
+        }
+    }
+
+    if (NonTemporal) {
+        simd_store_fence();
+    }
+
+    for (; i < cnt; ++i) {
+        transform_one(src + 3 * i, dst + 3 * i);
+    }
+
+#else /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+    float m[16];
+    store_simd_matrix(m, matrix);
+
+    for (; i < cnt; ++i) {
+        const auto x = src[3 * i];
+        const auto y = src[3 * i + 1];
+        const auto z = src[3 * i + 2];
+        dst[3 * i] = x * m[0] + y * m[4] + z * m[8] + m[12];
+        dst[3 * i + 1] = x * m[1] + y * m[5] + z * m[9] + m[13];
+        dst[3 * i + 2] = x * m[2] + y * m[6] + z * m[10] + m[14];
+    }
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+}
+
+
+
+/*
+ * XRTL_DETAIL_NAMESPACE::soa_load_poses
+ */
+inline XRTL_DETAIL_NAMESPACE::soa_poses XRTL_DETAIL_NAMESPACE::soa_load_poses(
+        _In_reads_(4) const XrPosef *poses) noexcept {
+    assert(poses != nullptr);
+    soa_poses retval;
+
+    retval.qx = load_simd_vector(poses[0].orientation);
+    retval.qy = load_simd_vector(poses[1].orientation);
+    retval.qz = load_simd_vector(poses[2].orientation);
+    retval.qw = load_simd_vector(poses[3].orientation);
+    simd_transpose(retval.qx, retval.qy, retval.qz, retval.qw);
+
+    retval.px = load_simd_vector(poses[0].position);
+    retval.py = load_simd_vector(poses[1].position);
+    retval.pz = load_simd_vector(poses[2].position);
+    auto pw = load_simd_vector(poses[3].position);
+    simd_transpose(retval.px, retval.py, retval.pz, pw);
+
+    return retval;
+}
+
+
+/*
+ * XRTL_DETAIL_NAMESPACE::soa_store_poses
+ */
+inline void XRTL_DETAIL_NAMESPACE::soa_store_poses(
+        _Out_writes_(4) XrPosef *dst,
+        _In_ const soa_poses& poses) noexcept {
+    assert(dst != nullptr);
+
+    auto qx = poses.qx;
+    auto qy = poses.qy;
+    auto qz = poses.qz;
+    auto qw = poses.qw;
+    simd_transpose(qx, qy, qz, qw);
+    store_simd_vector(dst[0].orientation, qx);
+    store_simd_vector(dst[1].orientation, qy);
+    store_simd_vector(dst[2].orientation, qz);
+    store_simd_vector(dst[3].orientation, qw);
+
+    auto px = poses.px;
+    auto py = poses.py;
+    auto pz = poses.pz;
+    auto pw = simd_splat(0.0f);
+    simd_transpose(px, py, pz, pw);
+    store_simd_vector(dst[0].position, px);
+    store_simd_vector(dst[1].position, py);
+    store_simd_vector(dst[2].position, pz);
+    store_simd_vector(dst[3].position, pw);
+}
+
+
+/*
+ * XRTL_DETAIL_NAMESPACE::interpolate_poses
+ */
+template<bool Slerp>
+void XRTL_DETAIL_NAMESPACE::interpolate_poses(
+        _In_reads_(cnt) const XrPosef *from,
+        _In_reads_(cnt) const XrPosef *to,
+        _In_ const std::size_t cnt,
+        _In_ const float t,
+        _Out_writes_(cnt) XrPosef *result) noexcept {
+    assert((from != nullptr) || (cnt == 0));
+    assert((to != nullptr) || (cnt == 0));
+    assert((result != nullptr) || (cnt == 0));
+    const auto tt = simd_splat(t);
+
+    // The inputs of each block are read before its output is written, so the
+    // operation can be performed in place.
+    const auto interpolate_block = [tt](const XrPosef *src0,
+            const XrPosef *src1, XrPosef *dst) {
+        const auto a = soa_load_poses(src0);
+        const auto b = soa_load_poses(src1);
+
+        soa_poses r;
+        if (Slerp) {
+            soa_slerp(r.qx, r.qy, r.qz, r.qw, a.qx, a.qy, a.qz, a.qw,
+                b.qx, b.qy, b.qz, b.qw, tt);
+        } else {
+            soa_nlerp(r.qx, r.qy, r.qz, r.qw, a.qx, a.qy, a.qz, a.qw,
+                b.qx, b.qy, b.qz, b.qw, tt);
+        }
+
+        r.px = simd_mul_add(tt, simd_sub(b.px, a.px), a.px);
+        r.py = simd_mul_add(tt, simd_sub(b.py, a.py), a.py);
+        r.pz = simd_mul_add(tt, simd_sub(b.pz, a.pz), a.pz);
+
+        soa_store_poses(dst, r);
+    };
+
+    std::size_t i = 0;
+    for (; i + 4 <= cnt; i += 4) {
+        interpolate_block(from + i, to + i, result + i);
+    }
+
+    // The remainder is padded with identity poses to form a full block.
+    if (i < cnt) {
+        const XrPosef identity { { 0.0f, 0.0f, 0.0f, 1.0f },
+            { 0.0f, 0.0f, 0.0f } };
+        XrPosef a[4] = { identity, identity, identity, identity };
+        XrPosef b[4] = { identity, identity, identity, identity };
+        XrPosef r[4];
+        std::copy(from + i, from + cnt, a);
+        std::copy(to + i, to + cnt, b);
+        interpolate_block(a, b, r);
+        std::copy(r, r + (cnt - i), result + i);
+    }
+}
+
+
+/*
+ * XRTL_DETAIL_NAMESPACE::extrapolate_poses
+ */
+template<class TVelocity>
+void XRTL_DETAIL_NAMESPACE::extrapolate_poses(
+        _In_reads_(cnt) const XrPosef *poses,
+        _In_reads_(cnt) const TVelocity *velocities,
+        _In_ const std::size_t cnt,
+        _In_ const float dt,
+        _Out_writes_(cnt) XrPosef *result) noexcept {
+    assert((poses != nullptr) || (cnt == 0));
+    assert((velocities != nullptr) || (cnt == 0));
+    assert((result != nullptr) || (cnt == 0));
+
+    // The rotation is the quaternion (sin(a / 2) * axis, cos(a / 2)) with
+    // the angle a = |w| * dt. The sine and cosine are evaluated as Taylor
+    // polynomials for the quarter angle h = a / 4, which are accurate for
+    // h up to pi / 2, and the half angle is obtained by the double-angle
+    // formulas. This has the advantage that only h^2 is required, so
+    // neither a square root nor a division by |w| is needed.
+    constexpr float cos_coeffs[] = { 1.0f, -1.0f / 2.0f, 1.0f / 24.0f,
+        -1.0f / 720.0f, 1.0f / 40320.0f, -1.0f / 3628800.0f,
+        1.0f / 479001600.0f };
+    constexpr float sinc_coeffs[] = { 1.0f, -1.0f / 6.0f, 1.0f / 120.0f,
+        -1.0f / 5040.0f, 1.0f / 362880.0f, -1.0f / 39916800.0f,
+        1.0f / 6227020800.0f };
+    constexpr auto degree = sizeof(cos_coeffs) / sizeof(*cos_coeffs);
+    static_assert(degree == sizeof(sinc_coeffs) / sizeof(*sinc_coeffs),
+        "The polynomials must be of the same degree.");
+
+    const auto t = simd_splat(dt);
+    const auto half_t = simd_splat(0.5f * dt);
+    const auto quarter_t2 = simd_splat(dt * dt / 16.0f);
+    const auto zero = simd_splat(0.0f);
+
+    const auto extrapolate_block = [&](const XrPosef *src,
+            const TVelocity *vel, XrPosef *dst) {
+        const auto p = soa_load_poses(src);
+
+        // Velocities that are not valid are treated as zero.
+        simd_vector l[4], w[4];
+        for (std::size_t j = 0; j < 4; ++j) {
+            const auto& v = vel[j];
+            l[j] = (v.velocityFlags & XR_SPACE_VELOCITY_LINEAR_VALID_BIT)
+                ? load_simd_vector(v.linearVelocity) : zero;
+            w[j] = (v.velocityFlags & XR_SPACE_VELOCITY_ANGULAR_VALID_BIT)
+                ? load_simd_vector(v.angularVelocity) : zero;
+        }
+        simd_transpose(l[0], l[1], l[2], l[3]);
+        simd_transpose(w[0], w[1], w[2], w[3]);
+
+        soa_poses r;
+        r.px = simd_mul_add(l[0], t, p.px);
+        r.py = simd_mul_add(l[1], t, p.py);
+        r.pz = simd_mul_add(l[2], t, p.pz);
+
+        const auto h2 = simd_mul(quarter_t2, simd_mul_add(w[0], w[0],
+            simd_mul_add(w[1], w[1], simd_mul(w[2], w[2]))));
+        auto c = simd_splat(cos_coeffs[degree - 1]);
+        auto s = simd_splat(sinc_coeffs[degree - 1]);
+        for (std::size_t k = degree - 1; k-- > 0;) {
+            c = simd_mul_add(c, h2, simd_splat(cos_coeffs[k]));
+            s = simd_mul_add(s, h2, simd_splat(sinc_coeffs[k]));
+        }
+
+        // cos(2h) = cos^2(h) - h^2 sinc^2(h) and
+        // sin(2h) / |w| = 2 h sinc(h) cos(h) / |w| = dt / 2 sinc(h) cos(h).
+        const auto dw = simd_sub(simd_mul(c, c),
+            simd_mul(h2, simd_mul(s, s)));
+        const auto f = simd_mul(half_t, simd_mul(s, c));
+
+        // The angular velocity is expressed in the base space, so the
+        // rotation is applied after the current orientation.
+        soa_multiply(r.qx, r.qy, r.qz, r.qw,
+            simd_mul(w[0], f), simd_mul(w[1], f), simd_mul(w[2], f), dw,
+            p.qx, p.qy, p.qz, p.qw);
+
+        soa_store_poses(dst, r);
+    };
+
+    std::size_t i = 0;
+    for (; i + 4 <= cnt; i += 4) {
+        extrapolate_block(poses + i, velocities + i, result + i);
+    }
+
+    // The remainder is padded with identity poses without velocity.
+    if (i < cnt) {
+        const XrPosef identity { { 0.0f, 0.0f, 0.0f, 1.0f },
+            { 0.0f, 0.0f, 0.0f } };
+        XrPosef p[4] = { identity, identity, identity, identity };
+        TVelocity v[4] { };
+        XrPosef r[4];
+        std::copy(poses + i, poses + cnt, p);
+        std::copy(velocities + i, velocities + cnt, v);
+        extrapolate_block(p, v, r);
+        std::copy(r, r + (cnt - i), result + i);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::multiply
+ */
+inline XrQuaternionf XRTL_NAMESPACE::multiply(_In_ const XrQuaternionf& lhs,
+        _In_ const XrQuaternionf& rhs) noexcept {
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    using namespace detail;
+    const auto a = load_simd_vector(lhs);
+    const auto b = load_simd_vector(rhs);
+
+    // Each component of the left-hand side scales a permutation of the
+    // right-hand side with alternating signs.
+    auto r = simd_mul(simd_permute<3, 3, 3, 3>(a), b);
+    r = simd_mul_add(simd_mul(simd_permute<0, 0, 0, 0>(a),
+        simd_permute<3, 2, 1, 0>(b)), simd_set(1.0f, -1.0f, 1.0f, -1.0f), r);
+    r = simd_mul_add(simd_mul(simd_permute<1, 1, 1, 1>(a),
+        simd_permute<2, 3, 0, 1>(b)), simd_set(1.0f, 1.0f, -1.0f, -1.0f), r);
+    r = simd_mul_add(simd_mul(simd_permute<2, 2, 2, 2>(a),
+        simd_permute<1, 0, 3, 2>(b)), simd_set(-1.0f, 1.0f, 1.0f, -1.0f), r);
+
+    XrQuaternionf retval;
+    store_simd_vector(retval, r);
+    return retval;
+
+#else /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+    const auto& a = lhs;
+    const auto& b = rhs;
+    return XrQuaternionf {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+}
+
+
+/*
+ * XRTL_NAMESPACE::rotate
+ */
+inline XrVector3f XRTL_NAMESPACE::rotate(_In_ const XrQuaternionf& q,
+        _In_ const XrVector3f& v) noexcept {
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    using namespace detail;
+    const auto a = load_simd_vector(q);
+    const auto b = load_simd_vector(v);
+    const auto a_yzx = simd_permute<1, 2, 0, 3>(a);
+    const auto a_zxy = simd_permute<2, 0, 1, 3>(a);
+
+    // The w-component of v is zero, so the one of the cross products is,
+    // too.
+    auto t = simd_sub(simd_mul(a_yzx, simd_permute<2, 0, 1, 3>(b)),
+        simd_mul(a_zxy, simd_permute<1, 2, 0, 3>(b)));
+    t = simd_add(t, t);
+
+    auto r = simd_mul_add(simd_permute<3, 3, 3, 3>(a), t, b);
+    r = simd_add(r, simd_sub(simd_mul(a_yzx, simd_permute<2, 0, 1, 3>(t)),
+        simd_mul(a_zxy, simd_permute<1, 2, 0, 3>(t))));
+
+    XrVector3f retval;
+    store_simd_vector(retval, r);
+    return retval;
+
+#else /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+    const auto tx = 2.0f * (q.y * v.z - q.z * v.y);
+    const auto ty = 2.0f * (q.z * v.x - q.x * v.z);
+    const auto tz = 2.0f * (q.x * v.y - q.y * v.x);
+    return XrVector3f {
+        v.x + q.w * tx + q.y * tz - q.z * ty,
+        v.y + q.w * ty + q.z * tx - q.x * tz,
+        v.z + q.w * tz + q.x * ty - q.y * tx
+    };
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+}
+
+
+/*
+ * XRTL_NAMESPACE::compose
+ */
+inline XrPosef XRTL_NAMESPACE::compose(_In_ const XrPosef& lhs,
+        _In_ const XrPosef& rhs) noexcept {
+    XrPosef retval;
+    retval.orientation = multiply(lhs.orientation, rhs.orientation);
+    retval.position = transform_point(lhs, rhs.position);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::invert
+ */
+inline XrPosef XRTL_NAMESPACE::invert(_In_ const XrPosef& pose) noexcept {
+    XrPosef retval;
+    retval.orientation = invert(pose.orientation);
+    retval.position = rotate(retval.orientation, pose.position);
+    retval.position.x = -retval.position.x;
+    retval.position.y = -retval.position.y;
+    retval.position.z = -retval.position.z;
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::relative_pose
+ */
+inline XrPosef XRTL_NAMESPACE::relative_pose(_In_ const XrPosef& base,
+        _In_ const XrPosef& pose) noexcept {
+    const auto inverse = invert(base.orientation);
+    const XrVector3f offset {
+        pose.position.x - base.position.x,
+        pose.position.y - base.position.y,
+        pose.position.z - base.position.z
+    };
+
+    XrPosef retval;
+    retval.orientation = multiply(inverse, pose.orientation);
+    retval.position = rotate(inverse, offset);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::transform_point
+ */
+inline XrVector3f XRTL_NAMESPACE::transform_point(_In_ const XrPosef& pose,
+        _In_ const XrVector3f& point) noexcept {
+    auto retval = rotate(pose.orientation, point);
+    retval.x += pose.position.x;
+    retval.y += pose.position.y;
+    retval.z += pose.position.z;
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::transform_points
+ */
+inline void XRTL_NAMESPACE::transform_points(_In_ const simd_matrix& matrix,
+        _In_reads_(cnt) const XrVector3f *points,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) XrVector3f *result,
+        _In_ const store_hint hint) noexcept {
+    if (hint == store_hint::non_temporal) {
+        detail::transform_vectors<true>(matrix, points, cnt, result);
+    } else {
+        detail::transform_vectors<false>(matrix, points, cnt, result);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::transform_points
+ */
+inline void XRTL_NAMESPACE::transform_points(_In_ const XrPosef& pose,
+        _In_reads_(cnt) const XrVector3f *points,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) XrVector3f *result,
+        _In_ const store_hint hint) noexcept {
+    transform_points(load_simd_matrix(pose), points, cnt, result, hint);
+}
+
+
+/*
+ * XRTL_NAMESPACE::transform_directions
+ */
+inline void XRTL_NAMESPACE::transform_directions(_In_ const XrPosef& pose,
+        _In_reads_(cnt) const XrVector3f *directions,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) XrVector3f *result,
+        _In_ const store_hint hint) noexcept {
+    auto matrix = load_simd_matrix(pose);
+    matrix.r[3] = detail::simd_splat(0.0f);
+    transform_points(matrix, directions, cnt, result, hint);
+}
+
+
+/*
+ * XRTL_NAMESPACE::nlerp
+ */
+inline XrQuaternionf XRTL_NAMESPACE::nlerp(_In_ const XrQuaternionf& q0,
+        _In_ const XrQuaternionf& q1,
+        _In_ const float t) noexcept {
+    using namespace detail;
+    simd_vector x, y, z, w;
+    soa_nlerp(x, y, z, w,
+        simd_splat(q0.x), simd_splat(q0.y), simd_splat(q0.z), simd_splat(q0.w),
+        simd_splat(q1.x), simd_splat(q1.y), simd_splat(q1.z), simd_splat(q1.w),
+        simd_splat(t));
+
+    // All lanes hold the same result, which is gathered in the first row.
+    simd_transpose(x, y, z, w);
+    XrQuaternionf retval;
+    store_simd_vector(retval, x);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::slerp
+ */
+inline XrQuaternionf XRTL_NAMESPACE::slerp(_In_ const XrQuaternionf& q0,
+        _In_ const XrQuaternionf& q1,
+        _In_ const float t) noexcept {
+    using namespace detail;
+    simd_vector x, y, z, w;
+    soa_slerp(x, y, z, w,
+        simd_splat(q0.x), simd_splat(q0.y), simd_splat(q0.z), simd_splat(q0.w),
+        simd_splat(q1.x), simd_splat(q1.y), simd_splat(q1.z), simd_splat(q1.w),
+        simd_splat(t));
+
+    // All lanes hold the same result, which is gathered in the first row.
+    simd_transpose(x, y, z, w);
+    XrQuaternionf retval;
+    store_simd_vector(retval, x);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::interpolate
+ */
+inline XrPosef XRTL_NAMESPACE::interpolate(_In_ const XrPosef& from,
+        _In_ const XrPosef& to,
+        _In_ const float t,
+        _In_ const interpolation method) noexcept {
+    XrPosef retval;
+    interpolate(&from, &to, 1, t, &retval, method);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::interpolate
+ */
+inline void XRTL_NAMESPACE::interpolate(_In_reads_(cnt) const XrPosef *from,
+        _In_reads_(cnt) const XrPosef *to,
+        _In_ const std::size_t cnt,
+        _In_ const float t,
+        _Out_writes_(cnt) XrPosef *result,
+        _In_ const interpolation method) noexcept {
+    if (method == interpolation::nlerp) {
+        detail::interpolate_poses<false>(from, to, cnt, t, result);
+    } else {
+        detail::interpolate_poses<true>(from, to, cnt, t, result);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::extrapolate
+ */
+inline XrPosef XRTL_NAMESPACE::extrapolate(_In_ const XrPosef& pose,
+        _In_ const XrSpaceVelocity& velocity,
+        _In_ const float dt) noexcept {
+    XrPosef retval;
+    detail::extrapolate_poses(&pose, &velocity, 1, dt, &retval);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::extrapolate
+ */
+inline void XRTL_NAMESPACE::extrapolate(_In_reads_(cnt) const XrPosef *poses,
+        _In_reads_(cnt) const XrSpaceVelocity *velocities,
+        _In_ const std::size_t cnt,
+        _In_ const float dt,
+        _Out_writes_(cnt) XrPosef *result) noexcept {
+    detail::extrapolate_poses(poses, velocities, cnt, dt, result);
+}
+
+
+#if defined(XR_VERSION_1_1)
+/*
+ * XRTL_NAMESPACE::extrapolate
+ */
+inline XrPosef XRTL_NAMESPACE::extrapolate(_In_ const XrPosef& pose,
+        _In_ const XrSpaceVelocityData& velocity,
+        _In_ const float dt) noexcept {
+    XrPosef retval;
+    detail::extrapolate_poses(&pose, &velocity, 1, dt, &retval);
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::extrapolate
+ */
+inline void XRTL_NAMESPACE::extrapolate(_In_reads_(cnt) const XrPosef *poses,
+        _In_reads_(cnt) const XrSpaceVelocityData *velocities,
+        _In_ const std::size_t cnt,
+        _In_ const float dt,
+        _Out_writes_(cnt) XrPosef *result) noexcept {
+    detail::extrapolate_poses(poses, velocities, cnt, dt, result);
+}
+#endif /* defined(XR_VERSION_1_1) */
@@ -0,0 +1,410 @@
+﻿// <copyright file="pose_soa.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_POSE_SOA_H)
+#define _XRTL_POSE_SOA_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/pose.h"
+#include "xrtl/simd.h"
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Releases memory allocated with an alignment requirement.
+/// </summary>
+struct aligned_delete final {
+    /// <summary>
+    /// The alignment of the memory in bytes.
+    /// </summary>
+    static constexpr std::size_t alignment = 32;
+
+    /// <summary>
+    /// Releases the given memory.
+    /// </summary>
+    inline void operator ()(_In_opt_ float *p) const noexcept {
+        ::operator delete[](p, std::align_val_t(alignment));
+    }
+};
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A container storing poses as structure of arrays, ie with each component
+/// of the position and the orientation in a separate array.
+/// </summary>
+/// <remarks>
+/// <para>The layout allows the operations on the poses to process as many
+/// poses at once as the SIMD backend in <c>simd.h</c> supports. Each array is
+/// aligned to 32 bytes and padded to a multiple of eight elements. The
+/// padding holds identity poses, which allows for processing the arrays
+/// without handling a remainder.</para>
+/// <para>All operations expect the orientations to be unit quaternions.
+/// </para>
+/// </remarks>
+class pose_soa final {
+
+public:
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline pose_soa(void) noexcept : _size(0), _stride(0) { }
+
+    /// <summary>
+    /// Initialises a new instance holding the given number of identity
+    /// poses.
+    /// </summary>
+    /// <param name="size">The number of poses.</param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    inline explicit pose_soa(_In_ const std::size_t size) : pose_soa() {
+        this->resize(size);
+    }
+
+    /// <summary>
+    /// Initialises a new instance from an array of poses.
+    /// </summary>
+    /// <param name="poses">The poses to be copied.</param>
+    /// <param name="cnt">The number of elements in <paramref name="poses" />.
+    /// </param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    inline pose_soa(_In_reads_(cnt) const XrPosef *poses,
+            _In_ const std::size_t cnt) : pose_soa() {
+        this->assign(poses, cnt);
+    }
+
+    /// <summary>
+    /// Clone <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The object to be cloned.</param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    pose_soa(_In_ const pose_soa& rhs);
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    pose_soa(_Inout_ pose_soa&& rhs) noexcept;
+
+    /// <summary>
+    /// Replaces the content with the given poses.
+    /// </summary>
+    /// <param name="poses">The poses to be copied.</param>
+    /// <param name="cnt">The number of elements in <paramref name="poses" />.
+    /// </param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    void assign(_In_reads_(cnt) const XrPosef *poses,
+        _In_ const std::size_t cnt);
+
+    /// <summary>
+    /// Replaces the content with the poses of the given space locations.
+    /// </summary>
+    /// <remarks>
+    /// The location flags are not evaluated, so the caller is responsible
+    /// for handling locations whose position or orientation is invalid.
+    /// </remarks>
+    /// <param name="locations">The locations to copy the poses from.</param>
+    /// <param name="cnt">The number of elements in
+    /// <paramref name="locations" />.</param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    void assign(_In_reads_(cnt) const XrSpaceLocation *locations,
+        _In_ const std::size_t cnt);
+
+    /// <summary>
+    /// Removes all poses and releases the memory.
+    /// </summary>
+    inline void clear(void) noexcept {
+        this->_data.reset();
+        this->_size = 0;
+        this->_stride = 0;
+    }
+
+    /// <summary>
+    /// Copies the poses into an array of structures.
+    /// </summary>
+    /// <param name="poses">Receives the poses.</param>
+    /// <param name="cnt">The number of elements in <paramref name="poses" />,
+    /// which must not exceed <see cref="size" />.</param>
+    void copy_to(_Out_writes_(cnt) XrPosef *poses,
+        _In_ const std::size_t cnt) const noexcept;
+
+    /// <summary>
+    /// Copies the poses into the given space locations.
+    /// </summary>
+    /// <remarks>
+    /// Only the poses are written, the type, the extension chain and the
+    /// location flags remain unchanged.
+    /// </remarks>
+    /// <param name="locations">Receives the poses.</param>
+    /// <param name="cnt">The number of elements in
+    /// <paramref name="locations" />, which must not exceed
+    /// <see cref="size" />.</param>
+    void copy_to(_Inout_updates_(cnt) XrSpaceLocation *locations,
+        _In_ const std::size_t cnt) const noexcept;
+
+    /// <summary>
+    /// Answer whether the container holds no poses.
+    /// </summary>
+    /// <returns><c>true</c> if the container is empty, <c>false</c>
+    /// otherwise.</returns>
+    inline bool empty(void) const noexcept {
+        return (this->_size == 0);
+    }
+
+    /// <summary>
+    /// Gets the pose at the given position.
+    /// </summary>
+    /// <param name="i">The index of the pose, which must be less than
+    /// <see cref="size" />.</param>
+    /// <returns>A copy of the pose.</returns>
+    XrPosef get(_In_ const std::size_t i) const noexcept;
+
+    /// <summary>
+    /// Changes the number of poses.
+    /// </summary>
+    /// <remarks>
+    /// Existing poses are preserved, new ones are initialised with the
+    /// identity. If the size changes, all pointers to the arrays are
+    /// invalidated.
+    /// </remarks>
+    /// <param name="size">The new number of poses.</param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    void resize(_In_ const std::size_t size);
+
+    /// <summary>
+    /// Sets the pose at the given position.
+    /// </summary>
+    /// <param name="i">The index of the pose, which must be less than
+    /// <see cref="size" />.</param>
+    /// <param name="pose">The new pose.</param>
+    void set(_In_ const std::size_t i, _In_ const XrPosef& pose) noexcept;
+
+    /// <summary>
+    /// Gets the number of poses.
+    /// </summary>
+    /// <returns>The number of poses.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_size;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in each array including the padding.
+    /// </summary>
+    /// <returns>The number of elements in each array, which is a multiple of
+    /// eight.</returns>
+    inline std::size_t stride(void) const noexcept {
+        return this->_stride;
+    }
+
+    /// <summary>
+    /// Gets the x-components of the positions.
+    /// </summary>
+    inline float *px(void) noexcept { return this->array(0); }
+
+    /// <summary>
+    /// Gets the x-components of the positions.
+    /// </summary>
+    inline const float *px(void) const noexcept { return this->array(0); }
+
+    /// <summary>
+    /// Gets the y-components of the positions.
+    /// </summary>
+    inline float *py(void) noexcept { return this->array(1); }
+
+    /// <summary>
+    /// Gets the y-components of the positions.
+    /// </summary>
+    inline const float *py(void) const noexcept { return this->array(1); }
+
+    /// <summary>
+    /// Gets the z-components of the positions.
+    /// </summary>
+    inline float *pz(void) noexcept { return this->array(2); }
+
+    /// <summary>
+    /// Gets the z-components of the positions.
+    /// </summary>
+    inline const float *pz(void) const noexcept { return this->array(2); }
+
+    /// <summary>
+    /// Gets the x-components of the orientations.
+    /// </summary>
+    inline float *qx(void) noexcept { return this->array(3); }
+
+    /// <summary>
+    /// Gets the x-components of the orientations.
+    /// </summary>
+    inline const float *qx(void) const noexcept { return this->array(3); }
+
+    /// <summary>
+    /// Gets the y-components of the orientations.
+    /// </summary>
+    inline float *qy(void) noexcept { return this->array(4); }
+
+    /// <summary>
+    /// Gets the y-components of the orientations.
+    /// </summary>
+    inline const float *qy(void) const noexcept { return this->array(4); }
+
+    /// <summary>
+    /// Gets the z-components of the orientations.
+    /// </summary>
+    inline float *qz(void) noexcept { return this->array(5); }
+
+    /// <summary>
+    /// Gets the z-components of the orientations.
+    /// </summary>
+    inline const float *qz(void) const noexcept { return this->array(5); }
+
+    /// <summary>
+    /// Gets the w-components of the orientations.
+    /// </summary>
+    inline float *qw(void) noexcept { return this->array(6); }
+
+    /// <summary>
+    /// Gets the w-components of the orientations.
+    /// </summary>
+    inline const float *qw(void) const noexcept { return this->array(6); }
+
+    /// <summary>
+    /// Assignment.
+    /// </summary>
+    /// <param name="rhs">The right-hand side operand.</param>
+    /// <returns><c>*this</c>.</returns>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    pose_soa& operator =(_In_ const pose_soa& rhs);
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The right-hand side operand.</param>
+    /// <returns><c>*this</c>.</returns>
+    pose_soa& operator =(_Inout_ pose_soa&& rhs) noexcept;
+
+private:
+
+    /// <summary>
+    /// The number of arrays, which are px, py, pz, qx, qy, qz and qw.
+    /// </summary>
+    static constexpr std::size_t arrays = 7;
+
+    /// <summary>
+    /// The granularity of <see cref="_stride" />.
+    /// </summary>
+    static constexpr std::size_t lanes = 8;
+
+    inline float *array(_In_ const std::size_t i) noexcept {
+        return this->_data.get() + i * this->_stride;
+    }
+
+    inline const float *array(_In_ const std::size_t i) const noexcept {
+        return this->_data.get() + i * this->_stride;
+    }
+
+    template<class TGet> void gather(_In_ const std::size_t cnt,
+        _In_ TGet&& get);
+
+    template<class TGet> void scatter(_In_ const std::size_t cnt,
+        _In_ TGet&& get) const noexcept;
+
+    std::unique_ptr<float[], detail::aligned_delete> _data;
+    std::size_t _size;
+    std::size_t _stride;
+};
+
+
+/// <summary>
+/// Composes two sets of poses element-wise, ie transforms each pose in
+/// <paramref name="rhs" /> from the space of the corresponding pose in
+/// <paramref name="lhs" />.
+/// </summary>
+/// <remarks>
+/// The orientation of the result is <c>lhs.q * rhs.q</c> and the position is
+/// <c>lhs.p + lhs.q * rhs.p</c>. <paramref name="result" /> may be the same
+/// object as one of the inputs.
+/// </remarks>
+/// <param name="lhs">The outer poses.</param>
+/// <param name="rhs">The inner poses, which must be the same number as in
+/// <paramref name="lhs" />.</param>
+/// <param name="result">Receives the composed poses.</param>
+/// <exception cref="std::invalid_argument">If the number of poses in the
+/// inputs do not match and the default error policy throws. Otherwise,
+/// <paramref name="result" /> remains unchanged in this case.</exception>
+/// <exception cref="std::bad_alloc">If <paramref name="result" /> could not
+/// be resized.</exception>
+void compose(_In_ const pose_soa& lhs, _In_ const pose_soa& rhs,
+    _Out_ pose_soa& result);
+
+/// <summary>
+/// Transforms all poses in <paramref name="rhs" /> from the space of the pose
+/// <paramref name="lhs" />.
+/// </summary>
+/// <remarks>
+/// <paramref name="result" /> may be the same object as
+/// <paramref name="rhs" />.
+/// </remarks>
+/// <param name="lhs">The outer pose, for instance the pose of a tracking
+/// space.</param>
+/// <param name="rhs">The inner poses.</param>
+/// <param name="result">Receives the composed poses.</param>
+/// <exception cref="std::bad_alloc">If <paramref name="result" /> could not
+/// be resized.</exception>
+void compose(_In_ const XrPosef& lhs, _In_ const pose_soa& rhs,
+    _Out_ pose_soa& result);
+
+/// <summary>
+/// Inverts all poses.
+/// </summary>
+/// <remarks>
+/// <paramref name="result" /> may be the same object as
+/// <paramref name="poses" />.
+/// </remarks>
+/// <param name="poses">The poses to be inverted.</param>
+/// <param name="result">Receives the inverted poses.</param>
+/// <exception cref="std::bad_alloc">If <paramref name="result" /> could not
+/// be resized.</exception>
+void invert(_In_ const pose_soa& poses, _Out_ pose_soa& result);
+
+/// <summary>
+/// Converts all poses into matrices.
+/// </summary>
+/// <remarks>
+/// The matrices have the same layout as the ones created by
+/// <see cref="store_simd_matrix" />, so <c>glm::mat4</c> and
+/// <c>DirectX::XMFLOAT4X4</c> can be used as destination.
+/// </remarks>
+/// <param name="poses">The poses to be converted.</param>
+/// <param name="matrices">Receives <c>16 * poses.size()</c> floats.</param>
+void to_matrices(_In_ const pose_soa& poses,
+    _Out_writes_(16 * poses.size()) float *matrices) noexcept;
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/pose_soa.inl"
+
+#endif /* !defined(_XRTL_POSE_SOA_H) */
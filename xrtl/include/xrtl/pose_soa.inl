@@ -0,0 +1,459 @@
+﻿// <copyright file="pose_soa.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::pose_soa
+ */
+inline XRTL_NAMESPACE::pose_soa::pose_soa(_In_ const pose_soa& rhs)
+        : pose_soa() {
+    *this = rhs;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::pose_soa
+ */
+inline XRTL_NAMESPACE::pose_soa::pose_soa(_Inout_ pose_soa&& rhs) noexcept
+    : _data(std::move(rhs._data)),
+        _size(rhs._size),
+        _stride(rhs._stride) {
+    rhs._size = 0;
+    rhs._stride = 0;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::assign
+ */
+inline void XRTL_NAMESPACE::pose_soa::assign(
+        _In_reads_(cnt) const XrPosef *poses,
+        _In_ const std::size_t cnt) {
+    assert((poses != nullptr) || (cnt == 0));
+    this->gather(cnt, [poses](const std::size_t i) -> const XrPosef& {
+        return poses[i];
+    });
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::assign
+ */
+inline void XRTL_NAMESPACE::pose_soa::assign(
+        _In_reads_(cnt) const XrSpaceLocation *locations,
+        _In_ const std::size_t cnt) {
+    assert((locations != nullptr) || (cnt == 0));
+    this->gather(cnt, [locations](const std::size_t i) -> const XrPosef& {
+        return locations[i].pose;
+    });
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::copy_to
+ */
+inline void XRTL_NAMESPACE::pose_soa::copy_to(
+        _Out_writes_(cnt) XrPosef *poses,
+        _In_ const std::size_t cnt) const noexcept {
+    assert((poses != nullptr) || (cnt == 0));
+    this->scatter(cnt, [poses](const std::size_t i) -> XrPosef& {
+        return poses[i];
+    });
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::copy_to
+ */
+inline void XRTL_NAMESPACE::pose_soa::copy_to(
+        _Inout_updates_(cnt) XrSpaceLocation *locations,
+        _In_ const std::size_t cnt) const noexcept {
+    assert((locations != nullptr) || (cnt == 0));
+    this->scatter(cnt, [locations](const std::size_t i) -> XrPosef& {
+        return locations[i].pose;
+    });
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::get
+ */
+inline XrPosef XRTL_NAMESPACE::pose_soa::get(
+        _In_ const std::size_t i) const noexcept {
+    assert(i < this->_size);
+    XrPosef retval;
+    retval.orientation.x = this->qx()[i];
+    retval.orientation.y = this->qy()[i];
+    retval.orientation.z = this->qz()[i];
+    retval.orientation.w = this->qw()[i];
+    retval.position.x = this->px()[i];
+    retval.position.y = this->py()[i];
+    retval.position.z = this->pz()[i];
+    return retval;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::resize
+ */
+inline void XRTL_NAMESPACE::pose_soa::resize(_In_ const std::size_t size) {
+    const auto stride = (size + lanes - 1) / lanes * lanes;
+
+    if (stride != this->_stride) {
+        typedef detail::aligned_delete deleter_type;
+        std::unique_ptr<float[], deleter_type> data(static_cast<float *>(
+            ::operator new[](arrays * stride * sizeof(float),
+            std::align_val_t(deleter_type::alignment))));
+
+        const auto retained = (std::min)(size, this->_size);
+        for (std::size_t a = 0; a < arrays; ++a) {
+            std::copy(this->array(a), this->array(a) + retained,
+                data.get() + a * stride);
+        }
+
+        this->_data = std::move(data);
+        this->_stride = stride;
+        this->_size = retained;
+    }
+
+    // Initialise new poses and the padding with the identity.
+    const auto begin = (std::min)(size, this->_size);
+    for (std::size_t a = 0; a < arrays; ++a) {
+        const auto value = (a == 6) ? 1.0f : 0.0f;
+        std::fill(this->array(a) + begin, this->array(a) + this->_stride,
+            value);
+    }
+
+    this->_size = size;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::set
+ */
+inline void XRTL_NAMESPACE::pose_soa::set(_In_ const std::size_t i,
+        _In_ const XrPosef& pose) noexcept {
+    assert(i < this->_size);
+    this->qx()[i] = pose.orientation.x;
+    this->qy()[i] = pose.orientation.y;
+    this->qz()[i] = pose.orientation.z;
+    this->qw()[i] = pose.orientation.w;
+    this->px()[i] = pose.position.x;
+    this->py()[i] = pose.position.y;
+    this->pz()[i] = pose.position.z;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::operator =
+ */
+inline XRTL_NAMESPACE::pose_soa& XRTL_NAMESPACE::pose_soa::operator =(
+        _In_ const pose_soa& rhs) {
+    if (this != std::addressof(rhs)) {
+        this->resize(rhs._size);
+        assert(this->_stride == rhs._stride);
+        std::copy(rhs._data.get(), rhs._data.get() + arrays * rhs._stride,
+            this->_data.get());
+    }
+
+    return *this;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::operator =
+ */
+inline XRTL_NAMESPACE::pose_soa& XRTL_NAMESPACE::pose_soa::operator =(
+        _Inout_ pose_soa&& rhs) noexcept {
+    if (this != std::addressof(rhs)) {
+        this->_data = std::move(rhs._data);
+        this->_size = rhs._size;
+        this->_stride = rhs._stride;
+        rhs._size = 0;
+        rhs._stride = 0;
+    }
+
+    return *this;
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::gather
+ */
+template<class TGet>
+void XRTL_NAMESPACE::pose_soa::gather(_In_ const std::size_t cnt,
+        _In_ TGet&& get) {
+    using namespace detail;
+    this->resize(cnt);
+
+    std::size_t i = 0;
+    for (; i + 4 <= cnt; i += 4) {
+        auto qx = load_simd_vector(get(i).orientation);
+        auto qy = load_simd_vector(get(i + 1).orientation);
+        auto qz = load_simd_vector(get(i + 2).orientation);
+        auto qw = load_simd_vector(get(i + 3).orientation);
+        simd_transpose(qx, qy, qz, qw);
+        simd_store4(this->qx() + i, qx);
+        simd_store4(this->qy() + i, qy);
+        simd_store4(this->qz() + i, qz);
+        simd_store4(this->qw() + i, qw);
+
+        auto px = load_simd_vector(get(i).position);
+        auto py = load_simd_vector(get(i + 1).position);
+        auto pz = load_simd_vector(get(i + 2).position);
+        auto pw = load_simd_vector(get(i + 3).position);
+        simd_transpose(px, py, pz, pw);
+        simd_store4(this->px() + i, px);
+        simd_store4(this->py() + i, py);
+        simd_store4(this->pz() + i, pz);
+    }
+
+    for (; i < cnt; ++i) {
+        this->set(i, get(i));
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::pose_soa::scatter
+ */
+template<class TGet>
+void XRTL_NAMESPACE::pose_soa::scatter(_In_ const std::size_t cnt,
+        _In_ TGet&& get) const noexcept {
+    using namespace detail;
+    assert(cnt <= this->_size);
+
+    std::size_t i = 0;
+    for (; i + 4 <= cnt; i += 4) {
+        auto qx = simd_load4(this->qx() + i);
+        auto qy = simd_load4(this->qy() + i);
+        auto qz = simd_load4(this->qz() + i);
+        auto qw = simd_load4(this->qw() + i);
+        simd_transpose(qx, qy, qz, qw);
+        store_simd_vector(get(i).orientation, qx);
+        store_simd_vector(get(i + 1).orientation, qy);
+        store_simd_vector(get(i + 2).orientation, qz);
+        store_simd_vector(get(i + 3).orientation, qw);
+
+        auto px = simd_load4(this->px() + i);
+        auto py = simd_load4(this->py() + i);
+        auto pz = simd_load4(this->pz() + i);
+        auto pw = simd_splat(0.0f);
+        simd_transpose(px, py, pz, pw);
+        store_simd_vector(get(i).position, px);
+        store_simd_vector(get(i + 1).position, py);
+        store_simd_vector(get(i + 2).position, pz);
+        store_simd_vector(get(i + 3).position, pw);
+    }
+
+    for (; i < cnt; ++i) {
+        get(i) = this->get(i);
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::compose
+ */
+inline void XRTL_NAMESPACE::compose(_In_ const pose_soa& lhs,
+        _In_ const pose_soa& rhs,
+        _Out_ pose_soa& result) {
+    using namespace detail;
+
+    if (lhs.size() != rhs.size()) {
+        default_error_policy::on_invalid_argument("The number of poses to "
+            "be composed must match.");
+        return;
+    }
+
+    result.resize(lhs.size());
+    assert(result.stride() == lhs.stride());
+
+    // All arrays are padded with identity poses, so there is no remainder.
+    for (std::size_t i = 0; i < lhs.stride(); i += 4) {
+        const auto aqx = simd_load4(lhs.qx() + i);
+        const auto aqy = simd_load4(lhs.qy() + i);
+        const auto aqz = simd_load4(lhs.qz() + i);
+        const auto aqw = simd_load4(lhs.qw() + i);
+        const auto apx = simd_load4(lhs.px() + i);
+        const auto apy = simd_load4(lhs.py() + i);
+        const auto apz = simd_load4(lhs.pz() + i);
+        const auto bqx = simd_load4(rhs.qx() + i);
+        const auto bqy = simd_load4(rhs.qy() + i);
+        const auto bqz = simd_load4(rhs.qz() + i);
+        const auto bqw = simd_load4(rhs.qw() + i);
+        const auto bpx = simd_load4(rhs.px() + i);
+        const auto bpy = simd_load4(rhs.py() + i);
+        const auto bpz = simd_load4(rhs.pz() + i);
+
+        simd_vector qx, qy, qz, qw;
+        soa_multiply(qx, qy, qz, qw, aqx, aqy, aqz, aqw, bqx, bqy, bqz, bqw);
+
+        simd_vector px, py, pz;
+        soa_rotate(px, py, pz, aqx, aqy, aqz, aqw, bpx, bpy, bpz);
+
+        simd_store4(result.qx() + i, qx);
+        simd_store4(result.qy() + i, qy);
+        simd_store4(result.qz() + i, qz);
+        simd_store4(result.qw() + i, qw);
+        simd_store4(result.px() + i, simd_add(apx, px));
+        simd_store4(result.py() + i, simd_add(apy, py));
+        simd_store4(result.pz() + i, simd_add(apz, pz));
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::compose
+ */
+inline void XRTL_NAMESPACE::compose(_In_ const XrPosef& lhs,
+        _In_ const pose_soa& rhs,
+        _Out_ pose_soa& result) {
+    using namespace detail;
+    result.resize(rhs.size());
+    assert(result.stride() == rhs.stride());
+
+    const auto aqx = simd_splat(lhs.orientation.x);
+    const auto aqy = simd_splat(lhs.orientation.y);
+    const auto aqz = simd_splat(lhs.orientation.z);
+    const auto aqw = simd_splat(lhs.orientation.w);
+    const auto apx = simd_splat(lhs.position.x);
+    const auto apy = simd_splat(lhs.position.y);
+    const auto apz = simd_splat(lhs.position.z);
+
+    for (std::size_t i = 0; i < rhs.stride(); i += 4) {
+        const auto bqx = simd_load4(rhs.qx() + i);
+        const auto bqy = simd_load4(rhs.qy() + i);
+        const auto bqz = simd_load4(rhs.qz() + i);
+        const auto bqw = simd_load4(rhs.qw() + i);
+        const auto bpx = simd_load4(rhs.px() + i);
+        const auto bpy = simd_load4(rhs.py() + i);
+        const auto bpz = simd_load4(rhs.pz() + i);
+
+        simd_vector qx, qy, qz, qw;
+        soa_multiply(qx, qy, qz, qw, aqx, aqy, aqz, aqw, bqx, bqy, bqz, bqw);
+
+        simd_vector px, py, pz;
+        soa_rotate(px, py, pz, aqx, aqy, aqz, aqw, bpx, bpy, bpz);
+
+        simd_store4(result.qx() + i, qx);
+        simd_store4(result.qy() + i, qy);
+        simd_store4(result.qz() + i, qz);
+        simd_store4(result.qw() + i, qw);
+        simd_store4(result.px() + i, simd_add(apx, px));
+        simd_store4(result.py() + i, simd_add(apy, py));
+        simd_store4(result.pz() + i, simd_add(apz, pz));
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::invert
+ */
+inline void XRTL_NAMESPACE::invert(_In_ const pose_soa& poses,
+        _Out_ pose_soa& result) {
+    using namespace detail;
+    result.resize(poses.size());
+    assert(result.stride() == poses.stride());
+
+    const auto zero = simd_splat(0.0f);
+
+    for (std::size_t i = 0; i < poses.stride(); i += 4) {
+        // The inverse of a unit quaternion is its conjugate.
+        const auto qx = simd_sub(zero, simd_load4(poses.qx() + i));
+        const auto qy = simd_sub(zero, simd_load4(poses.qy() + i));
+        const auto qz = simd_sub(zero, simd_load4(poses.qz() + i));
+        const auto qw = simd_load4(poses.qw() + i);
+        const auto px = simd_load4(poses.px() + i);
+        const auto py = simd_load4(poses.py() + i);
+        const auto pz = simd_load4(poses.pz() + i);
+
+        simd_vector rx, ry, rz;
+        soa_rotate(rx, ry, rz, qx, qy, qz, qw, px, py, pz);
+
+        simd_store4(result.qx() + i, qx);
+        simd_store4(result.qy() + i, qy);
+        simd_store4(result.qz() + i, qz);
+        simd_store4(result.qw() + i, qw);
+        simd_store4(result.px() + i, simd_sub(zero, rx));
+        simd_store4(result.py() + i, simd_sub(zero, ry));
+        simd_store4(result.pz() + i, simd_sub(zero, rz));
+    }
+}
+
+
+/*
+ * XRTL_NAMESPACE::to_matrices
+ */
+inline void XRTL_NAMESPACE::to_matrices(_In_ const pose_soa& poses,
+        _Out_writes_(16 * poses.size()) float *matrices) noexcept {
+    using namespace detail;
+    assert((matrices != nullptr) || poses.empty());
+
+    const auto zero = simd_splat(0.0f);
+    const auto one = simd_splat(1.0f);
+
+    for (std::size_t i = 0; i < poses.size(); i += 4) {
+        const auto qx = simd_load4(poses.qx() + i);
+        const auto qy = simd_load4(poses.qy() + i);
+        const auto qz = simd_load4(poses.qz() + i);
+        const auto qw = simd_load4(poses.qw() + i);
+
+        const auto x2 = simd_add(qx, qx);
+        const auto y2 = simd_add(qy, qy);
+        const auto z2 = simd_add(qz, qz);
+        const auto xx = simd_mul(qx, x2);
+        const auto yy = simd_mul(qy, y2);
+        const auto zz = simd_mul(qz, z2);
+        const auto xy = simd_mul(qx, y2);
+        const auto xz = simd_mul(qx, z2);
+        const auto yz = simd_mul(qy, z2);
+        const auto wx = simd_mul(qw, x2);
+        const auto wy = simd_mul(qw, y2);
+        const auto wz = simd_mul(qw, z2);
+
+        simd_vector rows[4][4] = {
+            {
+                simd_sub(one, simd_add(yy, zz)),
+                simd_add(xy, wz),
+                simd_sub(xz, wy),
+                zero
+            },
+            {
+                simd_sub(xy, wz),
+                simd_sub(one, simd_add(xx, zz)),
+                simd_add(yz, wx),
+                zero
+            },
+            {
+                simd_add(xz, wy),
+                simd_sub(yz, wx),
+                simd_sub(one, simd_add(xx, yy)),
+                zero
+            },
+            {
+                simd_load4(poses.px() + i),
+                simd_load4(poses.py() + i),
+                simd_load4(poses.pz() + i),
+                one
+            }
+        };
+
+        // Transposing yields the rows of the individual matrices.
+        for (auto& r : rows) {
+            simd_transpose(r[0], r[1], r[2], r[3]);
+        }
+
+        const auto cnt = (std::min)(std::size_t(4), poses.size() - i);
+        for (std::size_t j = 0; j < cnt; ++j) {
+            auto m = matrices + 16 * (i + j);
+            simd_store4(m, rows[0][j]);
+            simd_store4(m + 4, rows[1][j]);
+            simd_store4(m + 8, rows[2][j]);
+            simd_store4(m + 12, rows[3][j]);
+        }
+    }
+}
@@ -0,0 +1,221 @@
+﻿// <copyright file="projection_cache.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_PROJECTION_CACHE_H)
+#define _XRTL_PROJECTION_CACHE_H
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+#include "xrtl/error_policy.h"
+#include "xrtl/matrix.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Memoises the projection matrices of a fixed number of views, which are
+/// only recomputed if the field of view or the clipping planes change.
+/// </summary>
+/// <remarks>
+/// <para>Runtimes typically report the same <see cref="XrView::fov" /> in
+/// every frame, so validating the input and evaluating the four tangents in
+/// <see cref="make_matrix" /> is usually wasted effort. The cache compares
+/// the field of view and the clipping planes bitwise to the input of the
+/// cached matrix of the view and only invokes the builder if they differ.
+/// </para>
+/// <para>The builder is part of the cache, so a cache must not be shared by
+/// different builders. Instances are not thread-safe.</para>
+/// </remarks>
+/// <typeparam name="TBuilder">The type of the function or lambda making an
+/// off-centre matrix, which must be something like <c>glm::frustumRH_ZO</c>
+/// or <c>XMMatrixPerspectiveOffCenterRH</c>.</typeparam>
+/// <typeparam name="Views">The number of views, which is 2 for a stereo
+/// configuration and 4 for a quad view configuration.</typeparam>
+template<class TBuilder, std::size_t Views = 2> class projection_cache final {
+
+public:
+
+    /// <summary>
+    /// The type of the function or lambda making the matrices.
+    /// </summary>
+    typedef TBuilder builder_type;
+
+    /// <summary>
+    /// The type of the matrices created by the builder.
+    /// </summary>
+    typedef decltype(std::declval<const builder_type&>()(0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f)) matrix_type;
+
+    /// <summary>
+    /// The number of views the cache holds matrices for.
+    /// </summary>
+    static constexpr std::size_t views = Views;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="builder">The builder function creating the matrices.
+    /// </param>
+    inline explicit projection_cache(
+            _In_ const builder_type& builder = builder_type())
+        : _builder(builder), _entries(), _hits(0), _misses(0) { }
+
+    /// <summary>
+    /// Gets the projection matrix for the given view, creating it only if
+    /// the input differs from the one of the cached matrix.
+    /// </summary>
+    /// <param name="view">The index of the view, which must be less than
+    /// <see cref="views" />.</param>
+    /// <param name="fov">The field of view from OpenXR.</param>
+    /// <param name="near_plane">The distance to the near clipping plane,
+    /// which must be positive.</param>
+    /// <param name="far_plane">The distance to the far clipping plane.
+    /// </param>
+    /// <returns>The projection matrix for the view. If the input is invalid
+    /// and the <see cref="default_error_policy" /> continues, this is the
+    /// previously cached matrix or a value-initialised one if there is none.
+    /// </returns>
+    /// <exception cref="std::invalid_argument">If the field of view or the
+    /// clipping planes are invalid and the
+    /// <see cref="default_error_policy" /> throws.</exception>
+    const matrix_type& get(_In_ const std::size_t view,
+        _In_ const XrFovf& fov,
+        _In_ const float near_plane,
+        _In_ const float far_plane);
+
+    /// <summary>
+    /// Gets the number of requests that were served from the cache.
+    /// </summary>
+    /// <returns>The number of cache hits.</returns>
+    inline std::uint64_t hits(void) const noexcept {
+        return this->_hits;
+    }
+
+    /// <summary>
+    /// Gets the fraction of requests that were served from the cache.
+    /// </summary>
+    /// <returns>The hit rate within [0, 1], which is zero if no matrix has
+    /// been requested yet.</returns>
+    inline double hit_rate(void) const noexcept {
+        const auto total = this->_hits + this->_misses;
+        return (total > 0)
+            ? static_cast<double>(this->_hits) / static_cast<double>(total)
+            : 0.0;
+    }
+
+    /// <summary>
+    /// Discards all cached matrices, which forces the builder to be invoked
+    /// on the next request.
+    /// </summary>
+    inline void invalidate(void) noexcept {
+        for (auto& e : this->_entries) {
+            e.valid = false;
+        }
+    }
+
+    /// <summary>
+    /// Gets the number of requests that required the builder to be invoked.
+    /// </summary>
+    /// <returns>The number of cache misses.</returns>
+    inline std::uint64_t misses(void) const noexcept {
+        return this->_misses;
+    }
+
+    /// <summary>
+    /// Resets the hit and miss counters.
+    /// </summary>
+    inline void reset_statistics(void) noexcept {
+        this->_hits = 0;
+        this->_misses = 0;
+    }
+
+    /// <summary>
+    /// Updates the matrices of all views from the output of
+    /// <c>xrLocateViews</c>.
+    /// </summary>
+    /// <param name="located">The views located by OpenXR.</param>
+    /// <param name="cnt">The number of elements in
+    /// <paramref name="located" />, which must not exceed
+    /// <see cref="views" />.</param>
+    /// <param name="near_plane">The distance to the near clipping plane,
+    /// which must be positive.</param>
+    /// <param name="far_plane">The distance to the far clipping plane.
+    /// </param>
+    /// <exception cref="std::invalid_argument">If a field of view or the
+    /// clipping planes are invalid and the
+    /// <see cref="default_error_policy" /> throws.</exception>
+    void update(_In_reads_(cnt) const XrView *located,
+        _In_ const std::size_t cnt,
+        _In_ const float near_plane,
+        _In_ const float far_plane);
+
+    /// <summary>
+    /// Gets the most recently cached matrix of the given view.
+    /// </summary>
+    /// <param name="view">The index of the view, which must be less than
+    /// <see cref="views" />.</param>
+    /// <returns>The cached matrix, which is value-initialised if no matrix
+    /// has been created for the view yet.</returns>
+    inline const matrix_type& operator [](
+            _In_ const std::size_t view) const noexcept {
+        assert(view < views);
+        return this->_entries[view].matrix;
+    }
+
+private:
+
+    /// <summary>
+    /// The input determining a projection matrix, which is compared bitwise.
+    /// </summary>
+    struct key_type {
+        XrFovf fov;
+        float near_plane;
+        float far_plane;
+    };
+
+    /// <summary>
+    /// A cached matrix and the input it was created from.
+    /// </summary>
+    struct entry_type {
+        key_type key;
+        matrix_type matrix;
+        bool valid;
+    };
+
+    builder_type _builder;
+    std::array<entry_type, views> _entries;
+    std::uint64_t _hits;
+    std::uint64_t _misses;
+};
+
+
+/// <summary>
+/// A <see cref="projection_cache" /> for stereo view configurations.
+/// </summary>
+template<class TBuilder>
+using stereo_projection_cache = projection_cache<TBuilder, 2>;
+
+/// <summary>
+/// A <see cref="projection_cache" /> for quad view configurations as in
+/// <c>XR_VARJO_quad_views</c>.
+/// </summary>
+template<class TBuilder>
+using quad_view_projection_cache = projection_cache<TBuilder, 4>;
+
+XRTL_NAMESPACE_END
+
+#include "xrtl/projection_cache.inl"
+
+#endif /* !defined(_XRTL_PROJECTION_CACHE_H) */
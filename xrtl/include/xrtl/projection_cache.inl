@@ -0,0 +1,65 @@
+﻿// <copyright file="projection_cache.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * XRTL_NAMESPACE::projection_cache<TBuilder, Views>::get
+ */
+template<class TBuilder, std::size_t Views>
+const typename XRTL_NAMESPACE::projection_cache<TBuilder, Views>::matrix_type&
+XRTL_NAMESPACE::projection_cache<TBuilder, Views>::get(
+        _In_ const std::size_t view,
+        _In_ const XrFovf& fov,
+        _In_ const float near_plane,
+        _In_ const float far_plane) {
+    static_assert(sizeof(key_type) == 6 * sizeof(float), "The key must not "
+        "contain padding, because it is compared bitwise.");
+    assert(view < views);
+    auto& entry = this->_entries[view];
+
+    key_type key;
+    key.fov = fov;
+    key.near_plane = near_plane;
+    key.far_plane = far_plane;
+
+    if (XRTL_LIKELY(entry.valid
+            && (std::memcmp(&entry.key, &key, sizeof(key)) == 0))) {
+        ++this->_hits;
+        return entry.matrix;
+    }
+
+    ++this->_misses;
+
+    auto error = detail::validate_projection(fov, near_plane, far_plane);
+    if (error != nullptr) {
+        default_error_policy::on_invalid_argument(error);
+        return entry.matrix;
+    }
+
+    entry.matrix = detail::make_unchecked_matrix(this->_builder, fov,
+        near_plane, far_plane);
+    entry.key = key;
+    entry.valid = true;
+
+    return entry.matrix;
+}
+
+
+/*
+ * XRTL_NAMESPACE::projection_cache<TBuilder, Views>::update
+ */
+template<class TBuilder, std::size_t Views>
+void XRTL_NAMESPACE::projection_cache<TBuilder, Views>::update(
+        _In_reads_(cnt) const XrView *located,
+        _In_ const std::size_t cnt,
+        _In_ const float near_plane,
+        _In_ const float far_plane) {
+    assert((located != nullptr) || (cnt == 0));
+    assert(cnt <= views);
+    for (std::size_t i = 0; i < cnt; ++i) {
+        this->get(i, located[i].fov, near_plane, far_plane);
+    }
+}
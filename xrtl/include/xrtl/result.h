@@ -8,15 +8,17 @@
 #define _XRTL_RESULT_H
 #pragma once
 
+#include "xrtl/error_policy.h"
 #include "xrtl/xr_error_category.h"
 
 
+#if XRTL_HAS_EXCEPTIONS
 /// <summary>
 /// Throw an <see cref="std::system_error" /> representing the given
 /// <see cref="XrResult" />.
 /// </summary>
 /// <param name="r">The <see cref="XrResult" /> used as error code.</param>
-#define THROW_XR_RESULT(r) throw std::system_error((r), xrtl::xr_category())
+#define THROW_XR_RESULT(r) xrtl::detail::throw_xr_result(r)
 
 /// <summary>
 /// Throw an <see cref="std::system_error" /> representing the given
@@ -25,8 +27,8 @@
 /// <param name="r">The <see cref="XrResult" /> used as error code.</param>
 /// <param name="c">The condition that needs to be fulfilled for the exception
 /// to be thrown.</param>
-#define THROW_XR_RESULT_IF(r, c) if (c) throw std::system_error((r), \
-xrtl::xr_category())
+#define THROW_XR_RESULT_IF(r, c) if (XRTL_UNLIKELY(c)) \
+xrtl::detail::throw_xr_result(r)
 
 /// <summary>
 /// Throw an <see cref="std::system_error" /> representing the given
@@ -36,8 +38,8 @@ xrtl::xr_category())
 /// <param name="c">The condition that needs to be fulfilled for the exception
 /// to be thrown.</param>
 /// <param name="m">A custom error message.</param>
-#define THROW_XR_RESULT_IF_MSG(r, c, m) if (c) throw std::system_error((r), \
-xrtl::xr_category(), (m));
+#define THROW_XR_RESULT_IF_MSG(r, c, m) if (XRTL_UNLIKELY(c)) \
+xrtl::detail::throw_xr_result((r), (m));
 
 /// <summary>
 /// Throw an <see cref="std::system_error" /> representing the given
@@ -46,7 +48,29 @@ xrtl::xr_category(), (m));
 /// <param name="r">The <see cref="XrResult" /> used as error code.</param>
 /// <param name="m">A custom error message.</param>
 #define THROW_XR_RESULT_MSG(r, m)\
-throw std::system_error((r), xrtl::xr_category(), (m))
+xrtl::detail::throw_xr_result((r), (m))
+
+#else /* XRTL_HAS_EXCEPTIONS */
+// If exceptions are disabled, the macros are routed to the default error
+// policy, which must not return from a failure, because the code following
+// the macros relies on the operation having succeeded.
+static_assert(!xrtl::default_error_policy::continues, "The default error "
+    "policy must not continue after a failure if exceptions are disabled.");
+
+#define THROW_XR_RESULT(r)\
+xrtl::default_error_policy::on_failure(static_cast<XrResult>(r), nullptr)
+
+#define THROW_XR_RESULT_IF(r, c) if (XRTL_UNLIKELY(c)) \
+xrtl::default_error_policy::on_failure(static_cast<XrResult>(r), nullptr)
+
+#define THROW_XR_RESULT_IF_MSG(r, c, m) if (XRTL_UNLIKELY(c)) \
+xrtl::default_error_policy::on_failure(static_cast<XrResult>(r), \
+    xrtl::detail::message_c_str(m));
+
+#define THROW_XR_RESULT_MSG(r, m)\
+xrtl::default_error_policy::on_failure(static_cast<XrResult>(r), \
+    xrtl::detail::message_c_str(m))
+#endif /* XRTL_HAS_EXCEPTIONS */
 
 /// <summary>
 /// Throw an <see cref="std::system_error" /> if the given expression yielding an
@@ -0,0 +1,1124 @@
+﻿// <copyright file="simd.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_SIMD_H)
+#define _XRTL_SIMD_H
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
+
+
+/// <summary>
+/// Selects the instruction set used by the SIMD backend.
+/// </summary>
+/// <remarks>
+/// <para>SSE2 is used on x86 and x64, NEON on ARM. If the compiler targets
+/// FMA, which is implied by AVX2, fused multiply-add instructions are used in
+/// addition. If it targets AVX, batch operations process eight elements at
+/// once. All other platforms use a scalar implementation with the same
+/// interface.</para>
+/// <para>Define <c>XRTL_NO_SIMD</c> before including the library to force the
+/// scalar implementation.</para>
+/// </remarks>
+#if defined(XRTL_NO_SIMD)
+#define XRTL_SIMD_SSE2 (0)
+#define XRTL_SIMD_NEON (0)
+
+#elif defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define XRTL_SIMD_SSE2 (1)
+#define XRTL_SIMD_NEON (0)
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define XRTL_SIMD_SSE2 (0)
+#define XRTL_SIMD_NEON (1)
+
+#else /* defined(XRTL_NO_SIMD) */
+#define XRTL_SIMD_SSE2 (0)
+#define XRTL_SIMD_NEON (0)
+#endif /* defined(XRTL_NO_SIMD) */
+
+#if XRTL_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__FMA__) || defined(__AVX2__)
+#include <immintrin.h>
+#define XRTL_SIMD_FMA (1)
+#endif /* defined(__FMA__) || defined(__AVX2__) */
+#if defined(__AVX__)
+#include <immintrin.h>
+#define XRTL_SIMD_AVX (1)
+#endif /* defined(__AVX__) */
+
+#elif XRTL_SIMD_NEON
+#include <arm_neon.h>
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define XRTL_SIMD_FMA (1)
+#endif /* defined(__aarch64__) || defined(_M_ARM64) */
+#endif /* XRTL_SIMD_SSE2 */
+
+#if !defined(XRTL_SIMD_FMA)
+#define XRTL_SIMD_FMA (0)
+#endif /* !defined(XRTL_SIMD_FMA) */
+
+#if !defined(XRTL_SIMD_AVX)
+#define XRTL_SIMD_AVX (0)
+#endif /* !defined(XRTL_SIMD_AVX) */
+
+
+XRTL_NAMESPACE_BEGIN
+
+#if XRTL_SIMD_SSE2
+/// <summary>
+/// The native four-component vector of the SIMD backend.
+/// </summary>
+typedef __m128 simd_vector;
+
+#elif XRTL_SIMD_NEON
+/// <summary>
+/// The native four-component vector of the SIMD backend.
+/// </summary>
+typedef float32x4_t simd_vector;
+
+#else /* XRTL_SIMD_SSE2 */
+/// <summary>
+/// The four-component vector of the scalar fallback.
+/// </summary>
+struct alignas(16) simd_vector {
+    float v[4];
+};
+#endif /* XRTL_SIMD_SSE2 */
+
+
+/// <summary>
+/// A 4x4 matrix stored as four <see cref="simd_vector" /> rows.
+/// </summary>
+/// <remarks>
+/// The layout is the one of <c>XMMATRIX</c>, ie the translation is in
+/// <c>r[3]</c>. In memory, this is the same as a column-major
+/// <c>glm::mat4</c>, so <see cref="store_simd_matrix" /> can write directly
+/// into either type.
+/// </remarks>
+struct simd_matrix {
+    simd_vector r[4];
+};
+
+
+/// <summary>
+/// Determines how batch operations write their results.
+/// </summary>
+enum class store_hint {
+
+    /// <summary>
+    /// The results are written through the cache, which is the best choice
+    /// if they are used soon or if they fit into the cache.
+    /// </summary>
+    cached,
+
+    /// <summary>
+    /// The results are written with non-temporal stores where the instruction
+    /// set supports them, which bypass the cache and therefore do not evict
+    /// other data. This is beneficial if the output is much larger than the
+    /// cache and not read again soon, for instance if it is uploaded to the
+    /// GPU.
+    /// </summary>
+    non_temporal
+};
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Reinterprets an OpenXR vector type as an array of floats.
+/// </summary>
+template<class TType, std::size_t Size>
+inline const float *simd_floats(_In_ const TType& v) noexcept {
+    static_assert(std::is_trivially_copyable<TType>::value, "The OpenXR "
+        "type is assumed to be a POD type.");
+    static_assert(sizeof(TType) == Size * sizeof(float), "The OpenXR type is "
+        "assumed to consist of floats only.");
+    return reinterpret_cast<const float *>(std::addressof(v));
+}
+
+/// <summary>
+/// Reinterprets an OpenXR vector type as an array of floats.
+/// </summary>
+template<class TType, std::size_t Size>
+inline float *simd_floats(_Inout_ TType& v) noexcept {
+    static_assert(std::is_trivially_copyable<TType>::value, "The OpenXR "
+        "type is assumed to be a POD type.");
+    static_assert(sizeof(TType) == Size * sizeof(float), "The OpenXR type is "
+        "assumed to consist of floats only.");
+    return reinterpret_cast<float *>(std::addressof(v));
+}
+
+/// <summary>
+/// Answer whether the components of <typeparamref name="TTo" /> and
+/// <typeparamref name="TFrom" /> are stored in the same order.
+/// </summary>
+/// <remarks>
+/// Types of the same size may still store their components in a different
+/// order, which is the case for quaternions of some GLM configurations. The
+/// headers of the maths libraries specialise this trait where the order is
+/// not obvious.
+/// </remarks>
+template<class TTo, class TFrom>
+struct same_component_order : std::true_type { };
+
+/// <summary>
+/// Reinterprets a pointer to <typeparamref name="TFrom" /> as a pointer to
+/// <typeparamref name="TTo" /> without copying.
+/// </summary>
+/// <remarks>
+/// All layout assumptions are checked at compile time, so the function
+/// cannot be instantiated for types that cannot be aliased.
+/// </remarks>
+template<class TTo, class TFrom>
+inline TTo *view_cast(_In_opt_ TFrom *p) noexcept {
+    static_assert(std::is_trivially_copyable<TFrom>::value, "The source type "
+        "is assumed to be a POD type.");
+    static_assert(std::is_trivially_copyable<TTo>::value, "The target type "
+        "is assumed to be a POD type.");
+    static_assert(sizeof(TTo) == sizeof(TFrom), "The source and target type "
+        "are assumed to have the same size.");
+    static_assert(alignof(TTo) <= alignof(TFrom), "The target type must not "
+        "require a stricter alignment than the source type.");
+    static_assert(same_component_order<std::remove_const_t<TTo>,
+        std::remove_const_t<TFrom>>::value, "The source and target type "
+        "must store their components in the same order.");
+    static_assert(std::is_const<TTo>::value || !std::is_const<TFrom>::value,
+        "A view of constant elements cannot be made mutable.");
+    return reinterpret_cast<TTo *>(p);
+}
+
+/// <summary>
+/// Determines the element type returned by a view function, which is the
+/// type that <typeparamref name="TMap" /> maps <typeparamref name="TType" />
+/// to with the constness of <typeparamref name="TType" />.
+/// </summary>
+template<template<class> class TMap, class TType>
+using view_t = std::conditional_t<std::is_const<TType>::value,
+    const typename TMap<std::remove_const_t<TType>>::type,
+    typename TMap<std::remove_const_t<TType>>::type>;
+
+/// <summary>
+/// Maps a type of a maths library to the OpenXR type with the same memory
+/// layout.
+/// </summary>
+/// <remarks>
+/// The specialisations are provided by the headers of the maths libraries.
+/// </remarks>
+template<class TType> struct openxr_view_type { };
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Reinterprets a span of <typeparamref name="TFrom" /> as a span of
+/// <typeparamref name="TTo" /> without copying.
+/// </summary>
+template<class TTo, class TFrom, std::size_t Extent>
+inline std::span<TTo, Extent> span_cast(
+        _In_ const std::span<TFrom, Extent> s) noexcept {
+    return std::span<TTo, Extent>(view_cast<TTo>(s.data()), s.size());
+}
+
+/// <summary>
+/// Determines the span returned by a view function, which holds the type
+/// that <typeparamref name="TMap" /> maps the elements to and preserves
+/// their constness.
+/// </summary>
+template<template<class> class TMap, class TType, std::size_t Extent>
+using span_view_t = std::span<view_t<TMap, TType>, Extent>;
+#endif /* defined(__cpp_lib_span) */
+
+/// <summary>
+/// Creates a vector from its components.
+/// </summary>
+inline simd_vector simd_set(_In_ const float x, _In_ const float y,
+        _In_ const float z, _In_ const float w) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_set_ps(w, z, y, x);
+#elif XRTL_SIMD_NEON
+    const float v[4] = { x, y, z, w };
+    return vld1q_f32(v);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { x, y, z, w } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Loads two floats into the x and y components, zeroing the others.
+/// </summary>
+inline simd_vector simd_load2(_In_reads_(2) const float *p) noexcept {
+#if XRTL_SIMD_SSE2
+    // __m64 may alias other types, whereas loading via double * would
+    // violate strict aliasing.
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(p));
+#elif XRTL_SIMD_NEON
+    return vcombine_f32(vld1_f32(p), vdup_n_f32(0.0f));
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { p[0], p[1], 0.0f, 0.0f } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Loads three floats into the x, y and z components, zeroing w.
+/// </summary>
+inline simd_vector simd_load3(_In_reads_(3) const float *p) noexcept {
+#if XRTL_SIMD_SSE2
+    const auto xy = _mm_loadl_pi(_mm_setzero_ps(),
+        reinterpret_cast<const __m64 *>(p));
+    const auto z = _mm_load_ss(p + 2);
+    return _mm_movelh_ps(xy, z);
+#elif XRTL_SIMD_NEON
+    return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2,
+        vdup_n_f32(0.0f), 0));
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { p[0], p[1], p[2], 0.0f } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Loads four unaligned floats.
+/// </summary>
+inline simd_vector simd_load4(_In_reads_(4) const float *p) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_loadu_ps(p);
+#elif XRTL_SIMD_NEON
+    return vld1q_f32(p);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { p[0], p[1], p[2], p[3] } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Stores the x and y components.
+/// </summary>
+inline void simd_store2(_Out_writes_(2) float *p,
+        _In_ const simd_vector v) noexcept {
+#if XRTL_SIMD_SSE2
+    _mm_storel_pi(reinterpret_cast<__m64 *>(p), v);
+#elif XRTL_SIMD_NEON
+    vst1_f32(p, vget_low_f32(v));
+#else /* XRTL_SIMD_SSE2 */
+    p[0] = v.v[0];
+    p[1] = v.v[1];
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Stores the x, y and z components.
+/// </summary>
+inline void simd_store3(_Out_writes_(3) float *p,
+        _In_ const simd_vector v) noexcept {
+#if XRTL_SIMD_SSE2
+    _mm_storel_pi(reinterpret_cast<__m64 *>(p), v);
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+#elif XRTL_SIMD_NEON
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+#else /* XRTL_SIMD_SSE2 */
+    p[0] = v.v[0];
+    p[1] = v.v[1];
+    p[2] = v.v[2];
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Stores all four components to unaligned memory.
+/// </summary>
+inline void simd_store4(_Out_writes_(4) float *p,
+        _In_ const simd_vector v) noexcept {
+#if XRTL_SIMD_SSE2
+    _mm_storeu_ps(p, v);
+#elif XRTL_SIMD_NEON
+    vst1q_f32(p, v);
+#else /* XRTL_SIMD_SSE2 */
+    p[0] = v.v[0];
+    p[1] = v.v[1];
+    p[2] = v.v[2];
+    p[3] = v.v[3];
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Adds two vectors component-wise.
+/// </summary>
+inline simd_vector simd_add(_In_ const simd_vector l,
+        _In_ const simd_vector r) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_add_ps(l, r);
+#elif XRTL_SIMD_NEON
+    return vaddq_f32(l, r);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { l.v[0] + r.v[0], l.v[1] + r.v[1],
+        l.v[2] + r.v[2], l.v[3] + r.v[3] } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Subtracts two vectors component-wise.
+/// </summary>
+inline simd_vector simd_sub(_In_ const simd_vector l,
+        _In_ const simd_vector r) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_sub_ps(l, r);
+#elif XRTL_SIMD_NEON
+    return vsubq_f32(l, r);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { l.v[0] - r.v[0], l.v[1] - r.v[1],
+        l.v[2] - r.v[2], l.v[3] - r.v[3] } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Multiplies two vectors component-wise.
+/// </summary>
+inline simd_vector simd_mul(_In_ const simd_vector l,
+        _In_ const simd_vector r) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_mul_ps(l, r);
+#elif XRTL_SIMD_NEON
+    return vmulq_f32(l, r);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { l.v[0] * r.v[0], l.v[1] * r.v[1],
+        l.v[2] * r.v[2], l.v[3] * r.v[3] } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Computes <c>a * b + c</c> component-wise.
+/// </summary>
+inline simd_vector simd_mul_add(_In_ const simd_vector a,
+        _In_ const simd_vector b,
+        _In_ const simd_vector c) noexcept {
+#if XRTL_SIMD_SSE2 && XRTL_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#elif XRTL_SIMD_NEON && XRTL_SIMD_FMA
+    return vfmaq_f32(c, a, b);
+#elif XRTL_SIMD_NEON
+    return vmlaq_f32(c, a, b);
+#else /* XRTL_SIMD_SSE2 && XRTL_SIMD_FMA */
+    return simd_add(simd_mul(a, b), c);
+#endif /* XRTL_SIMD_SSE2 && XRTL_SIMD_FMA */
+}
+
+/// <summary>
+/// Negates the components of <paramref name="v" /> for which the sign bit of
+/// the corresponding component of <paramref name="s" /> is set.
+/// </summary>
+inline simd_vector simd_flip_sign(_In_ const simd_vector v,
+        _In_ const simd_vector s) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_xor_ps(v, _mm_and_ps(s, _mm_set1_ps(-0.0f)));
+#elif XRTL_SIMD_NEON
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v),
+        vandq_u32(vreinterpretq_u32_f32(s), vdupq_n_u32(0x80000000u))));
+#else /* XRTL_SIMD_SSE2 */
+    simd_vector retval;
+    for (std::size_t i = 0; i < 4; ++i) {
+        retval.v[i] = std::signbit(s.v[i]) ? -v.v[i] : v.v[i];
+    }
+    return retval;
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Computes the reciprocal square root component-wise.
+/// </summary>
+/// <remarks>
+/// Unlike the estimate instructions of the instruction sets, the result is
+/// accurate to the precision of a <c>float</c>, except for 32-bit ARM, which
+/// refines the estimate with two Newton-Raphson steps.
+/// </remarks>
+inline simd_vector simd_reciprocal_sqrt(_In_ const simd_vector v) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v));
+#elif XRTL_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+    return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(v));
+#elif XRTL_SIMD_NEON
+    auto retval = vrsqrteq_f32(v);
+    retval = vmulq_f32(retval, vrsqrtsq_f32(vmulq_f32(v, retval), retval));
+    retval = vmulq_f32(retval, vrsqrtsq_f32(vmulq_f32(v, retval), retval));
+    return retval;
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { 1.0f / std::sqrt(v.v[0]), 1.0f / std::sqrt(v.v[1]),
+        1.0f / std::sqrt(v.v[2]), 1.0f / std::sqrt(v.v[3]) } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Reorders the components of a vector.
+/// </summary>
+/// <typeparam name="X">The index of the input component that becomes x.
+/// </typeparam>
+/// <typeparam name="Y">The index of the input component that becomes y.
+/// </typeparam>
+/// <typeparam name="Z">The index of the input component that becomes z.
+/// </typeparam>
+/// <typeparam name="W">The index of the input component that becomes w.
+/// </typeparam>
+template<int X, int Y, int Z, int W>
+inline simd_vector simd_permute(_In_ const simd_vector v) noexcept {
+    static_assert((X >= 0) && (X < 4) && (Y >= 0) && (Y < 4)
+        && (Z >= 0) && (Z < 4) && (W >= 0) && (W < 4),
+        "The component indices must be within [0, 3].");
+#if XRTL_SIMD_SSE2
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+#elif XRTL_SIMD_NEON
+    // NEON has no general shuffle with immediate operands, so we map the
+    // patterns with a dedicated instruction and build all others from lane
+    // moves, which keeps the vector in the registers.
+    if constexpr ((X == 0) && (Y == 1) && (Z == 2) && (W == 3)) {
+        return v;
+    } else if constexpr ((X == Y) && (X == Z) && (X == W)) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        return vdupq_laneq_f32(v, X);
+#else /* defined(__aarch64__) || defined(_M_ARM64) */
+        return vdupq_n_f32(vgetq_lane_f32(v, X));
+#endif /* defined(__aarch64__) || defined(_M_ARM64) */
+    } else if constexpr ((X == 1) && (Y == 0) && (Z == 3) && (W == 2)) {
+        return vrev64q_f32(v);
+    } else if constexpr ((X == 2) && (Y == 3) && (Z == 0) && (W == 1)) {
+        return vextq_f32(v, v, 2);
+    } else if constexpr ((X == 3) && (Y == 2) && (Z == 1) && (W == 0)) {
+        const auto r = vrev64q_f32(v);
+        return vextq_f32(r, r, 2);
+    } else if constexpr ((X == 1) && (Y == 2) && (Z == 3) && (W == 0)) {
+        return vextq_f32(v, v, 1);
+    } else if constexpr ((X == 3) && (Y == 0) && (Z == 1) && (W == 2)) {
+        return vextq_f32(v, v, 3);
+    } else if constexpr ((X == 0) && (Y == 0) && (Z == 1) && (W == 1)) {
+        return vzipq_f32(v, v).val[0];
+    } else if constexpr ((X == 2) && (Y == 2) && (Z == 3) && (W == 3)) {
+        return vzipq_f32(v, v).val[1];
+    } else {
+        auto retval = vdupq_n_f32(vgetq_lane_f32(v, X));
+        retval = vsetq_lane_f32(vgetq_lane_f32(v, Y), retval, 1);
+        retval = vsetq_lane_f32(vgetq_lane_f32(v, Z), retval, 2);
+        retval = vsetq_lane_f32(vgetq_lane_f32(v, W), retval, 3);
+        return retval;
+    }
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { v.v[X], v.v[Y], v.v[Z], v.v[W] } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Sets all components of a vector to the same value.
+/// </summary>
+inline simd_vector simd_splat(_In_ const float v) noexcept {
+#if XRTL_SIMD_SSE2
+    return _mm_set1_ps(v);
+#elif XRTL_SIMD_NEON
+    return vdupq_n_f32(v);
+#else /* XRTL_SIMD_SSE2 */
+    return simd_vector { { v, v, v, v } };
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Transposes the 4x4 matrix formed by the given vectors in place.
+/// </summary>
+inline void simd_transpose(_Inout_ simd_vector& r0,
+        _Inout_ simd_vector& r1,
+        _Inout_ simd_vector& r2,
+        _Inout_ simd_vector& r3) noexcept {
+#if XRTL_SIMD_SSE2
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#elif XRTL_SIMD_NEON
+    const auto t01 = vtrnq_f32(r0, r1);
+    const auto t23 = vtrnq_f32(r2, r3);
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else /* XRTL_SIMD_SSE2 */
+    std::swap(r0.v[1], r1.v[0]);
+    std::swap(r0.v[2], r2.v[0]);
+    std::swap(r0.v[3], r3.v[0]);
+    std::swap(r1.v[2], r2.v[1]);
+    std::swap(r1.v[3], r3.v[1]);
+    std::swap(r2.v[3], r3.v[2]);
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Loads four consecutive vectors of three floats and transposes them such
+/// that each output holds one component of all four vectors.
+/// </summary>
+inline void simd_load3x4(_In_reads_(12) const float *p,
+        _Out_ simd_vector& x,
+        _Out_ simd_vector& y,
+        _Out_ simd_vector& z) noexcept {
+#if XRTL_SIMD_SSE2
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    const auto a = _mm_loadu_ps(p);
+    const auto b = _mm_loadu_ps(p + 4);
+    const auto c = _mm_loadu_ps(p + 8);
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)),
+        _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 1)),
+        _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)), c,
+        _MM_SHUFFLE(3, 0, 2, 0));
+#elif XRTL_SIMD_NEON
+    const auto v = vld3q_f32(p);
+    x = v.val[0];
+    y = v.val[1];
+    z = v.val[2];
+#else /* XRTL_SIMD_SSE2 */
+    for (std::size_t i = 0; i < 4; ++i) {
+        x.v[i] = p[3 * i];
+        y.v[i] = p[3 * i + 1];
+        z.v[i] = p[3 * i + 2];
+    }
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Transposes the components of four vectors back into four consecutive
+/// vectors of three floats and stores them.
+/// </summary>
+/// <typeparam name="NonTemporal">If <c>true</c>, the stores bypass the cache
+/// if the instruction set supports this, in which case <paramref name="p" />
+/// must be aligned to 16 bytes. <see cref="simd_store_fence" /> must be
+/// called after the last of these stores.</typeparam>
+template<bool NonTemporal>
+inline void simd_store3x4(_Out_writes_(12) float *p,
+        _In_ const simd_vector x,
+        _In_ const simd_vector y,
+        _In_ const simd_vector z) noexcept {
+#if XRTL_SIMD_SSE2
+    const auto a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm_shuffle_ps(z, x, _MM_SHUFFLE(0, 1, 0, 0)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    const auto b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(0, 1, 0, 1)),
+        _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    const auto c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(0, 3, 0, 2)),
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(0, 3, 0, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    if (NonTemporal) {
+        assert(reinterpret_cast<std::uintptr_t>(p) % 16 == 0);
+        _mm_stream_ps(p, a);
+        _mm_stream_ps(p + 4, b);
+        _mm_stream_ps(p + 8, c);
+    } else {
+        _mm_storeu_ps(p, a);
+        _mm_storeu_ps(p + 4, b);
+        _mm_storeu_ps(p + 8, c);
+    }
+#elif XRTL_SIMD_NEON
+    // There is no intrinsic for non-temporal stores on NEON.
+    float32x4x3_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f32(p, v);
+#else /* XRTL_SIMD_SSE2 */
+    for (std::size_t i = 0; i < 4; ++i) {
+        p[3 * i] = x.v[i];
+        p[3 * i + 1] = y.v[i];
+        p[3 * i + 2] = z.v[i];
+    }
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+/// <summary>
+/// Makes the results of non-temporal stores visible to subsequent stores.
+/// </summary>
+inline void simd_store_fence(void) noexcept {
+#if XRTL_SIMD_SSE2
+    _mm_sfence();
+#endif /* XRTL_SIMD_SSE2 */
+}
+
+#if XRTL_SIMD_AVX
+/// <summary>
+/// The eight-component vector used by batch operations if AVX is available.
+/// </summary>
+typedef __m256 simd_vector8;
+
+/// <summary>
+/// Sets all components of an eight-component vector to the same value.
+/// </summary>
+inline simd_vector8 simd_splat8(_In_ const float v) noexcept {
+    return _mm256_set1_ps(v);
+}
+
+/// <summary>
+/// Computes <c>a * b + c</c> component-wise.
+/// </summary>
+inline simd_vector8 simd_mul_add8(_In_ const simd_vector8 a,
+        _In_ const simd_vector8 b,
+        _In_ const simd_vector8 c) noexcept {
+#if XRTL_SIMD_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#else /* XRTL_SIMD_FMA */
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif /* XRTL_SIMD_FMA */
+}
+
+/// <summary>
+/// Loads eight consecutive vectors of three floats and transposes them such
+/// that each output holds one component of all eight vectors.
+/// </summary>
+/// <remarks>
+/// The vectors are loaded such that each 128-bit lane holds four of them,
+/// which allows for the same in-lane shuffles as
+/// <see cref="simd_load3x4" />.
+/// </remarks>
+inline void simd_load3x8(_In_reads_(24) const float *p,
+        _Out_ simd_vector8& x,
+        _Out_ simd_vector8& y,
+        _Out_ simd_vector8& z) noexcept {
+    const auto a = _mm256_insertf128_ps(_mm256_castps128_ps256(
+        _mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+    const auto b = _mm256_insertf128_ps(_mm256_castps128_ps256(
+        _mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+    const auto c = _mm256_insertf128_ps(_mm256_castps128_ps256(
+        _mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+    x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c,
+        _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 1)),
+        _mm256_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)),
+        c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+/// <summary>
+/// Transposes the components of eight vectors back into eight consecutive
+/// vectors of three floats and stores them.
+/// </summary>
+/// <typeparam name="NonTemporal">If <c>true</c>, the stores bypass the
+/// cache, in which case <paramref name="p" /> must be aligned to 32 bytes.
+/// <see cref="simd_store_fence" /> must be called after the last of these
+/// stores.</typeparam>
+template<bool NonTemporal>
+inline void simd_store3x8(_Out_writes_(24) float *p,
+        _In_ const simd_vector8 x,
+        _In_ const simd_vector8 y,
+        _In_ const simd_vector8 z) noexcept {
+    // Each lane holds four interleaved vectors, which are a, b and c of the
+    // lower lane followed by a, b and c of the upper lane in memory.
+    const auto a = _mm256_shuffle_ps(
+        _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm256_shuffle_ps(z, x, _MM_SHUFFLE(0, 1, 0, 0)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    const auto b = _mm256_shuffle_ps(
+        _mm256_shuffle_ps(y, z, _MM_SHUFFLE(0, 1, 0, 1)),
+        _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    const auto c = _mm256_shuffle_ps(
+        _mm256_shuffle_ps(z, x, _MM_SHUFFLE(0, 3, 0, 2)),
+        _mm256_shuffle_ps(y, z, _MM_SHUFFLE(0, 3, 0, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0));
+    const auto r0 = _mm256_permute2f128_ps(a, b, 0x20);
+    const auto r1 = _mm256_permute2f128_ps(c, a, 0x30);
+    const auto r2 = _mm256_permute2f128_ps(b, c, 0x31);
+
+    if (NonTemporal) {
+        assert(reinterpret_cast<std::uintptr_t>(p) % 32 == 0);
+        _mm256_stream_ps(p, r0);
+        _mm256_stream_ps(p + 8, r1);
+        _mm256_stream_ps(p + 16, r2);
+    } else {
+        _mm256_storeu_ps(p, r0);
+        _mm256_storeu_ps(p + 8, r1);
+        _mm256_storeu_ps(p + 16, r2);
+    }
+}
+#endif /* XRTL_SIMD_AVX */
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Loads an OpenXR 2D vector into a <see cref="simd_vector" />.
+/// </summary>
+/// <param name="v">The OpenXR vector to load.</param>
+/// <returns>The equivalent vector with z and w set to zero.</returns>
+inline simd_vector load_simd_vector(_In_ const XrVector2f& v) noexcept {
+    return detail::simd_load2(detail::simd_floats<XrVector2f, 2>(v));
+}
+
+
+/// <summary>
+/// Loads an OpenXR 3D vector into a <see cref="simd_vector" />.
+/// </summary>
+/// <param name="v">The OpenXR vector to load.</param>
+/// <returns>The equivalent vector with w set to zero.</returns>
+inline simd_vector load_simd_vector(_In_ const XrVector3f& v) noexcept {
+    return detail::simd_load3(detail::simd_floats<XrVector3f, 3>(v));
+}
+
+
+/// <summary>
+/// Loads an OpenXR 4D vector into a <see cref="simd_vector" />.
+/// </summary>
+/// <param name="v">The OpenXR vector to load.</param>
+/// <returns>The equivalent vector.</returns>
+inline simd_vector load_simd_vector(_In_ const XrVector4f& v) noexcept {
+    return detail::simd_load4(detail::simd_floats<XrVector4f, 4>(v));
+}
+
+
+/// <summary>
+/// Loads an OpenXR quaternion into a <see cref="simd_vector" />.
+/// </summary>
+/// <param name="v">The OpenXR quaternion to load.</param>
+/// <returns>The equivalent vector in the order x, y, z, w.</returns>
+inline simd_vector load_simd_vector(_In_ const XrQuaternionf& v) noexcept {
+    return detail::simd_load4(detail::simd_floats<XrQuaternionf, 4>(v));
+}
+
+
+/// <summary>
+/// Stores a <see cref="simd_vector" /> into an OpenXR 2D vector.
+/// </summary>
+/// <param name="d">The OpenXR vector to receive the data.</param>
+/// <param name="s">The vector that is the source of the data.</param>
+inline void store_simd_vector(_Out_ XrVector2f& d,
+        _In_ const simd_vector s) noexcept {
+    detail::simd_store2(detail::simd_floats<XrVector2f, 2>(d), s);
+}
+
+
+/// <summary>
+/// Stores a <see cref="simd_vector" /> into an OpenXR 3D vector.
+/// </summary>
+/// <param name="d">The OpenXR vector to receive the data.</param>
+/// <param name="s">The vector that is the source of the data.</param>
+inline void store_simd_vector(_Out_ XrVector3f& d,
+        _In_ const simd_vector s) noexcept {
+    detail::simd_store3(detail::simd_floats<XrVector3f, 3>(d), s);
+}
+
+
+/// <summary>
+/// Stores a <see cref="simd_vector" /> into an OpenXR 4D vector.
+/// </summary>
+/// <param name="d">The OpenXR vector to receive the data.</param>
+/// <param name="s">The vector that is the source of the data.</param>
+inline void store_simd_vector(_Out_ XrVector4f& d,
+        _In_ const simd_vector s) noexcept {
+    detail::simd_store4(detail::simd_floats<XrVector4f, 4>(d), s);
+}
+
+
+/// <summary>
+/// Stores a <see cref="simd_vector" /> into an OpenXR quaternion.
+/// </summary>
+/// <param name="d">The OpenXR quaternion to receive the data.</param>
+/// <param name="s">The vector that is the source of the data.</param>
+inline void store_simd_vector(_Out_ XrQuaternionf& d,
+        _In_ const simd_vector s) noexcept {
+    detail::simd_store4(detail::simd_floats<XrQuaternionf, 4>(d), s);
+}
+
+
+/// <summary>
+/// Loads an OpenXR pose into a <see cref="simd_matrix" />.
+/// </summary>
+/// <remarks>
+/// The result is the same as the one of <see cref="load_xmmatrix" /> and
+/// <see cref="to_glm" />. The orientation of the pose is expected to be a
+/// unit quaternion.
+/// </remarks>
+/// <param name="p">The pose to be transformed.</param>
+/// <returns>The matrix representing the given pose.</returns>
+inline simd_matrix load_simd_matrix(_In_ const XrPosef& p) noexcept {
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    using namespace detail;
+    const auto q = load_simd_vector(p.orientation);
+    const auto q2 = simd_add(q, q);
+
+    // Each row is the sum of a constant and two products of permuted
+    // quaternion components, which yields the same terms as
+    // XMMatrixRotationQuaternion and glm::mat3_cast.
+    simd_matrix retval;
+    {
+        const auto a = simd_mul(simd_permute<1, 0, 0, 3>(q),
+            simd_permute<1, 1, 2, 3>(q2));
+        const auto b = simd_mul(simd_permute<2, 3, 3, 3>(q),
+            simd_permute<2, 2, 1, 3>(q2));
+        retval.r[0] = simd_mul_add(b, simd_set(-1.0f, 1.0f, -1.0f, 0.0f),
+            simd_mul_add(a, simd_set(-1.0f, 1.0f, 1.0f, 0.0f),
+            simd_set(1.0f, 0.0f, 0.0f, 0.0f)));
+    }
+    {
+        const auto a = simd_mul(simd_permute<0, 0, 1, 3>(q),
+            simd_permute<1, 0, 2, 3>(q2));
+        const auto b = simd_mul(simd_permute<3, 2, 3, 3>(q),
+            simd_permute<2, 2, 0, 3>(q2));
+        retval.r[1] = simd_mul_add(b, simd_set(-1.0f, -1.0f, 1.0f, 0.0f),
+            simd_mul_add(a, simd_set(1.0f, -1.0f, 1.0f, 0.0f),
+            simd_set(0.0f, 1.0f, 0.0f, 0.0f)));
+    }
+    {
+        const auto a = simd_mul(simd_permute<0, 1, 0, 3>(q),
+            simd_permute<2, 2, 0, 3>(q2));
+        const auto b = simd_mul(simd_permute<3, 3, 1, 3>(q),
+            simd_permute<1, 0, 1, 3>(q2));
+        retval.r[2] = simd_mul_add(b, simd_set(1.0f, -1.0f, -1.0f, 0.0f),
+            simd_mul_add(a, simd_set(1.0f, 1.0f, -1.0f, 0.0f),
+            simd_set(0.0f, 0.0f, 1.0f, 0.0f)));
+    }
+
+    retval.r[3] = simd_add(load_simd_vector(p.position),
+        simd_set(0.0f, 0.0f, 0.0f, 1.0f));
+    return retval;
+
+#else /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+    // Without SIMD, the permutations are not free, so it is faster to compute
+    // the terms directly.
+    const auto& q = p.orientation;
+    const auto xx = q.x * q.x;
+    const auto yy = q.y * q.y;
+    const auto zz = q.z * q.z;
+    const auto xy = q.x * q.y;
+    const auto xz = q.x * q.z;
+    const auto yz = q.y * q.z;
+    const auto wx = q.w * q.x;
+    const auto wy = q.w * q.y;
+    const auto wz = q.w * q.z;
+
+    return simd_matrix { {
+        simd_vector { { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz),
+            2.0f * (xz - wy), 0.0f } },
+        simd_vector { { 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz),
+            2.0f * (yz + wx), 0.0f } },
+        simd_vector { { 2.0f * (xz + wy), 2.0f * (yz - wx),
+            1.0f - 2.0f * (xx + yy), 0.0f } },
+        simd_vector { { p.position.x, p.position.y, p.position.z, 1.0f } }
+    } };
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+}
+
+
+/// <summary>
+/// Loads the inverse of an OpenXR pose into a <see cref="simd_matrix" />,
+/// which is the view matrix if the pose is the one of a view.
+/// </summary>
+/// <remarks>
+/// <para>The pose is a rigid transformation, so its inverse is built
+/// directly from the conjugate of the orientation and the position rotated
+/// by it and negated. This is considerably cheaper than inverting the result
+/// of <see cref="load_simd_matrix" /> with a general 4x4 inverse.</para>
+/// <para>The orientation of the pose is expected to be a unit quaternion.
+/// </para>
+/// </remarks>
+/// <param name="p">The pose to be inverted.</param>
+/// <returns>The matrix representing the inverse of the given pose.
+/// </returns>
+inline simd_matrix load_simd_view_matrix(_In_ const XrPosef& p) noexcept {
+    XrPosef conjugate;
+    conjugate.orientation.x = -p.orientation.x;
+    conjugate.orientation.y = -p.orientation.y;
+    conjugate.orientation.z = -p.orientation.z;
+    conjugate.orientation.w = p.orientation.w;
+    conjugate.position.x = 0.0f;
+    conjugate.position.y = 0.0f;
+    conjugate.position.z = 0.0f;
+
+    // The rotational part of the inverse is the transposed rotation, which
+    // is the one of the conjugate quaternion. The last row is the negated
+    // position transformed by that rotation.
+    auto retval = load_simd_matrix(conjugate);
+
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    using namespace detail;
+    const auto t = simd_mul_add(simd_splat(p.position.x), retval.r[0],
+        simd_mul_add(simd_splat(p.position.y), retval.r[1],
+        simd_mul(simd_splat(p.position.z), retval.r[2])));
+    retval.r[3] = simd_sub(retval.r[3], t);
+
+#else /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+    const auto& t = p.position;
+    for (int i = 0; i < 3; ++i) {
+        retval.r[3].v[i] = -(t.x * retval.r[0].v[i] + t.y * retval.r[1].v[i]
+            + t.z * retval.r[2].v[i]);
+    }
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+
+    return retval;
+}
+
+
+/// <summary>
+/// Stores a <see cref="simd_matrix" /> into sixteen consecutive floats.
+/// </summary>
+/// <remarks>
+/// The destination can be a <c>glm::mat4</c> or a
+/// <c>DirectX::XMFLOAT4X4</c>, which both have the required layout.
+/// </remarks>
+/// <param name="d">The destination, which must be able to hold sixteen
+/// floats.</param>
+/// <param name="s">The matrix to be stored.</param>
+inline void store_simd_matrix(_Out_writes_(16) float *d,
+        _In_ const simd_matrix& s) noexcept {
+    detail::simd_store4(d, s.r[0]);
+    detail::simd_store4(d + 4, s.r[1]);
+    detail::simd_store4(d + 8, s.r[2]);
+    detail::simd_store4(d + 12, s.r[3]);
+}
+
+
+/// <summary>
+/// Converts a batch of OpenXR poses into matrices.
+/// </summary>
+/// <remarks>
+/// <para>The results are the same as calling <see cref="load_simd_matrix" />
+/// and <see cref="store_simd_matrix" /> for each pose. If a SIMD backend is
+/// available, four poses are converted at once by transposing their
+/// orientations such that each instruction works on the same component of
+/// four poses.</para>
+/// <para>The glm and DirectX Math interfaces provide overloads for their
+/// respective matrix types.</para>
+/// </remarks>
+/// <param name="poses">The poses to be converted.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" />.
+/// </param>
+/// <param name="matrices">Receives <c>16 * cnt</c> floats, which are the
+/// matrices of the poses in the order of the input.</param>
+inline void to_matrices(_In_reads_(cnt) const XrPosef *poses,
+        _In_ const std::size_t cnt,
+        _Out_writes_(16 * cnt) float *matrices) noexcept {
+    std::size_t i = 0;
+
+#if XRTL_SIMD_SSE2 || XRTL_SIMD_NEON
+    using namespace detail;
+    const auto zero = simd_splat(0.0f);
+    const auto one = simd_splat(1.0f);
+    const auto w = simd_set(0.0f, 0.0f, 0.0f, 1.0f);
+
+    for (; i + 4 <= cnt; i += 4) {
+        const auto p = poses + i;
+        auto qx = load_simd_vector(p[0].orientation);
+        auto qy = load_simd_vector(p[1].orientation);
+        auto qz = load_simd_vector(p[2].orientation);
+        auto qw = load_simd_vector(p[3].orientation);
+        simd_transpose(qx, qy, qz, qw);
+
+        const auto x2 = simd_add(qx, qx);
+        const auto y2 = simd_add(qy, qy);
+        const auto z2 = simd_add(qz, qz);
+        const auto xx = simd_mul(qx, x2);
+        const auto yy = simd_mul(qy, y2);
+        const auto zz = simd_mul(qz, z2);
+        const auto xy = simd_mul(qx, y2);
+        const auto xz = simd_mul(qx, z2);
+        const auto yz = simd_mul(qy, z2);
+        const auto wx = simd_mul(qw, x2);
+        const auto wy = simd_mul(qw, y2);
+        const auto wz = simd_mul(qw, z2);
+
+        // Each vector holds one element of the rotation for all four poses,
+        // so transposing them yields the rows of the individual matrices.
+        auto r00 = simd_sub(one, simd_add(yy, zz));
+        auto r01 = simd_add(xy, wz);
+        auto r02 = simd_sub(xz, wy);
+        auto r03 = zero;
+        simd_transpose(r00, r01, r02, r03);
+
+        auto r10 = simd_sub(xy, wz);
+        auto r11 = simd_sub(one, simd_add(xx, zz));
+        auto r12 = simd_add(yz, wx);
+        auto r13 = zero;
+        simd_transpose(r10, r11, r12, r13);
+
+        auto r20 = simd_add(xz, wy);
+        auto r21 = simd_sub(yz, wx);
+        auto r22 = simd_sub(one, simd_add(xx, yy));
+        auto r23 = zero;
+        simd_transpose(r20, r21, r22, r23);
+
+        const simd_vector rows[4][3] = {
+            { r00, r10, r20 },
+            { r01, r11, r21 },
+            { r02, r12, r22 },
+            { r03, r13, r23 }
+        };
+
+        for (std::size_t j = 0; j < 4; ++j) {
+            auto m = matrices + 16 * (i + j);
+            simd_store4(m, rows[j][0]);
+            simd_store4(m + 4, rows[j][1]);
+            simd_store4(m + 8, rows[j][2]);
+            simd_store4(m + 12, simd_add(load_simd_vector(p[j].position), w));
+        }
+    }
+#endif /* XRTL_SIMD_SSE2 || XRTL_SIMD_NEON */
+
+    for (; i < cnt; ++i) {
+        store_simd_matrix(matrices + 16 * i, load_simd_matrix(poses[i]));
+    }
+}
+
+
+/// <summary>
+/// Views an array of vectors of a maths library as the equivalent OpenXR
+/// type without copying.
+/// </summary>
+/// <remarks>
+/// The overloads for the types of glm and DirectX Math are enabled by
+/// including <c>xrtl/glm.h</c> and <c>xrtl/xmath.h</c>, respectively. They
+/// are the inverse of <see cref="as_glm" /> and <see cref="as_xmfloat" />.
+/// The returned pointer addresses as many elements as
+/// <paramref name="p" />.
+/// </remarks>
+/// <typeparam name="TType">The type of the elements, which may be
+/// <c>const</c>.</typeparam>
+/// <param name="p">A pointer to the elements to be reinterpreted.</param>
+/// <returns>A pointer to OpenXR vectors aliasing the same memory.</returns>
+template<class TType>
+inline detail::view_t<detail::openxr_view_type, TType> *as_openxr(
+        _In_opt_ TType *p) noexcept {
+    return detail::view_cast<detail::view_t<detail::openxr_view_type, TType>>(
+        p);
+}
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Views a span of vectors of a maths library as the equivalent OpenXR
+/// type without copying.
+/// </summary>
+/// <typeparam name="TType">The type of the elements, which may be
+/// <c>const</c>.</typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="s">The span to be reinterpreted.</param>
+/// <returns>A span of OpenXR vectors aliasing the same memory.</returns>
+template<class TType, std::size_t Extent>
+inline detail::span_view_t<detail::openxr_view_type, TType, Extent>
+as_openxr(_In_ const std::span<TType, Extent> s) noexcept {
+    typedef detail::span_view_t<detail::openxr_view_type, TType, Extent>
+        result_type;
+    return detail::span_cast<typename result_type::element_type>(s);
+}
+#endif /* defined(__cpp_lib_span) */
+
+XRTL_NAMESPACE_END
+
+#endif /* !defined(_XRTL_SIMD_H) */
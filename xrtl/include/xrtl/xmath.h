@@ -9,6 +9,8 @@
 #pragma once
 
 #if defined(_WIN32)
+#include <cassert>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -17,6 +19,11 @@
 #include <openxr/openxr.h>
 
 #include "xrtl/api.h"
+#include "xrtl/simd.h"
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif /* defined(__cpp_lib_span) */
 
 
 XRTL_NAMESPACE_BEGIN
@@ -178,6 +185,151 @@ inline DirectX::XMMATRIX load_xmmatrix(_In_ const XrPosef& p) noexcept {
     return retval;
 }
 
+
+/// <summary>
+/// Creates the DirectX view matrix for an OpenXR pose, which is the inverse
+/// of the matrix created by <see cref="load_xmmatrix" />.
+/// </summary>
+/// <remarks>
+/// The inverse is computed analytically from the rigid transformation, which
+/// is considerably cheaper than using <c>DirectX::XMMatrixInverse</c>.
+/// </remarks>
+/// <param name="p">The pose of the view, whose orientation must be a unit
+/// quaternion.</param>
+/// <returns>The XMMATRIX transforming from the space the pose is relative to
+/// into the space of the view.</returns>
+inline DirectX::XMMATRIX load_xmview_matrix(_In_ const XrPosef& p) noexcept {
+    auto r = DirectX::XMQuaternionConjugate(load_xmvector(p.orientation));
+    auto t = load_xmvector(p.position);
+    auto retval = DirectX::XMMatrixRotationQuaternion(r);
+    t = DirectX::XMVector3TransformNormal(t, retval);
+    retval.r[3] = DirectX::XMVectorSubtract(retval.r[3], t);
+    return retval;
+}
+
+
+/// <summary>
+/// Converts a batch of OpenXR poses into DirectX matrices.
+/// </summary>
+/// <remarks>
+/// The results are the same as the ones of converting each pose individually,
+/// but multiple poses are processed at once if SIMD instructions are
+/// available.
+/// </remarks>
+/// <param name="poses">The poses to be transformed.</param>
+/// <param name="cnt">The number of elements in <paramref name="poses" /> and
+/// <paramref name="matrices" />.</param>
+/// <param name="matrices">Receives the matrices in the order of the input.
+/// </param>
+inline void to_matrices(_In_reads_(cnt) const XrPosef *poses,
+        _In_ const std::size_t cnt,
+        _Out_writes_(cnt) DirectX::XMMATRIX *matrices) noexcept {
+    static_assert(sizeof(DirectX::XMMATRIX) == 16 * sizeof(float), "The matrix is "
+        "assumed to consist of sixteen floats.");
+    to_matrices(poses, cnt, reinterpret_cast<float *>(matrices));
+}
+
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Converts a batch of OpenXR poses into DirectX matrices.
+/// </summary>
+/// <param name="poses">The poses to be transformed.</param>
+/// <param name="matrices">Receives the matrices in the order of the input.
+/// This span must have the same size as <paramref name="poses" />.</param>
+inline void to_matrices(_In_ const std::span<const XrPosef> poses,
+        _In_ const std::span<DirectX::XMMATRIX> matrices) noexcept {
+    assert(poses.size() == matrices.size());
+    to_matrices(poses.data(), poses.size(), matrices.data());
+}
+#endif /* defined(__cpp_lib_span) */
+
+XRTL_NAMESPACE_END
+
+
+XRTL_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Maps an OpenXR type to the DirectX Math storage type with the same memory
+/// layout.
+/// </summary>
+template<class TType> struct xmfloat_view_type { };
+
+template<> struct xmfloat_view_type<XrVector2f> {
+    typedef DirectX::XMFLOAT2 type;
+};
+template<> struct xmfloat_view_type<XrExtent2Df> {
+    typedef DirectX::XMFLOAT2 type;
+};
+template<> struct xmfloat_view_type<XrVector3f> {
+    typedef DirectX::XMFLOAT3 type;
+};
+template<> struct xmfloat_view_type<XrVector4f> {
+    typedef DirectX::XMFLOAT4 type;
+};
+template<> struct xmfloat_view_type<XrQuaternionf> {
+    typedef DirectX::XMFLOAT4 type;
+};
+
+template<> struct openxr_view_type<DirectX::XMFLOAT2> {
+    typedef XrVector2f type;
+};
+template<> struct openxr_view_type<DirectX::XMFLOAT3> {
+    typedef XrVector3f type;
+};
+template<> struct openxr_view_type<DirectX::XMFLOAT4> {
+    typedef XrVector4f type;
+};
+
+XRTL_DETAIL_NAMESPACE_END
+
+
+XRTL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Views an array of OpenXR vectors, extents or quaternions as the
+/// equivalent DirectX Math storage type without copying.
+/// </summary>
+/// <remarks>
+/// Unlike <see cref="load_xmvector" />, this does not copy any data, so it
+/// is suitable for large arrays like hand joint positions or mesh vertices.
+/// The resulting <c>XMFLOAT3</c> et al. can be loaded with the usual
+/// DirectX Math functions, for instance <c>XMVector3TransformCoordStream</c>.
+/// The returned pointer addresses as many elements as
+/// <paramref name="p" />.
+/// </remarks>
+/// <typeparam name="TType">The OpenXR type, which may be <c>const</c>.
+/// </typeparam>
+/// <param name="p">A pointer to the elements to be reinterpreted.</param>
+/// <returns>A pointer to DirectX Math vectors aliasing the same memory.
+/// </returns>
+template<class TType>
+inline detail::view_t<detail::xmfloat_view_type, TType> *as_xmfloat(
+        _In_opt_ TType *p) noexcept {
+    return detail::view_cast<detail::view_t<detail::xmfloat_view_type,
+        TType>>(p);
+}
+
+#if defined(__cpp_lib_span)
+/// <summary>
+/// Views a span of OpenXR vectors, extents or quaternions as the equivalent
+/// DirectX Math storage type without copying.
+/// </summary>
+/// <typeparam name="TType">The OpenXR type, which may be <c>const</c>.
+/// </typeparam>
+/// <typeparam name="Extent">The extent of the span.</typeparam>
+/// <param name="s">The span to be reinterpreted.</param>
+/// <returns>A span of DirectX Math vectors aliasing the same memory.
+/// </returns>
+template<class TType, std::size_t Extent>
+inline detail::span_view_t<detail::xmfloat_view_type, TType, Extent>
+as_xmfloat(_In_ const std::span<TType, Extent> s) noexcept {
+    typedef detail::span_view_t<detail::xmfloat_view_type, TType, Extent>
+        result_type;
+    return detail::span_cast<typename result_type::element_type>(s);
+}
+#endif /* defined(__cpp_lib_span) */
+
 XRTL_NAMESPACE_END
 
 #endif /* defined(_WIN32) */
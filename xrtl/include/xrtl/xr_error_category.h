@@ -15,6 +15,7 @@
 
 #include "xrtl/api.h"
 #include "xrtl/unique_handle.h"
+#include "xrtl/xr_result_names.h"
 
 
 XRTL_NAMESPACE_BEGIN
@@ -27,6 +28,19 @@ XRTL_NAMESPACE_BEGIN
 /// call the method again with <c>XR_NULL_HANDLE</c>.</param>
 inline void xr_category_instance(_In_opt_ XrInstance instance);
 
+/// <summary>
+/// Sets the <paramref name="instance" /> in the OpenXR error category such
+/// that the category can retrieve an error string using the given
+/// <paramref name="to_string" /> function rather than the one exported by the
+/// loader.
+/// </summary>
+/// <param name="instance">The instance to be set. If you destroy the instance,
+/// call the method again with <c>XR_NULL_HANDLE</c>.</param>
+/// <param name="to_string">The <c>xrResultToString</c> function to be used.
+/// If <c>nullptr</c>, the function exported by the loader is used.</param>
+inline void xr_category_instance(_In_opt_ XrInstance instance,
+    _In_opt_ PFN_xrResultToString to_string);
+
 /// <summary>
 /// Sets the <paramref name="instance" /> in the OpenXR error category such
 /// that the category can retrieve an error string.
@@ -45,6 +59,12 @@ XRTL_DETAIL_NAMESPACE_BEGIN
 /// <summary>
 /// An error category for OpenXR result values.
 /// </summary>
+/// <remarks>
+/// The category retrieves the messages for all result codes known at compile
+/// time from <see cref="xr_result_name" />, which does not require an
+/// instance. Only unknown codes are passed to the runtime if an instance has
+/// been registered via <see cref="xr_category_instance" />.
+/// </remarks>
 /// <typeparam name="TError">The native error code.</typeparam>
 template<class TError>
 class xr_error_category final : public std::error_category {
@@ -55,7 +75,8 @@ public:
 
     using std::error_category::error_category;
 
-    inline xr_error_category(void) : _instance(nullptr) { }
+    inline xr_error_category(void)
+        : _instance(nullptr), _to_string(nullptr) { }
 
     std::error_condition default_error_condition(
         _In_ const int error) const noexcept override;
@@ -67,8 +88,10 @@ public:
 private:
 
     mutable XrInstance _instance;
+    mutable PFN_xrResultToString _to_string;
 
-    friend void xrtl::xr_category_instance(XrInstance);
+    friend void XRTL_NAMESPACE::xr_category_instance(XrInstance,
+        PFN_xrResultToString);
 };
 
 
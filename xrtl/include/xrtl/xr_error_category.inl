@@ -22,15 +22,29 @@ XRTL_DETAIL_NAMESPACE::xr_error_category<TError>::default_error_condition(
 template<class TError>
 std::string XRTL_DETAIL_NAMESPACE::xr_error_category<TError>::message(
         _In_ const int error) const {
-    if (this->_instance == nullptr) {
-        return std::to_string(error);
-
-    } else {
-        static char retval[XR_MAX_RESULT_STRING_SIZE];
-        auto result = static_cast<value_type>(error);
-        ::xrResultToString(this->_instance, result, retval);
-        return retval;
+    auto result = static_cast<value_type>(error);
+
+    {
+        auto retval = xr_result_name(result);
+        if (retval != nullptr) {
+            return retval;
+        }
+    }
+
+    if (this->_instance != nullptr) {
+        char retval[XR_MAX_RESULT_STRING_SIZE];
+        auto to_string = (this->_to_string != nullptr)
+            ? this->_to_string
+            : ::xrResultToString;
+        if (XR_SUCCEEDED(to_string(this->_instance, result, retval))) {
+            return retval;
+        }
     }
+
+    // Mimic the output of xrResultToString for unknown codes.
+    return std::string(XR_SUCCEEDED(result)
+        ? "XR_UNKNOWN_SUCCESS_"
+        : "XR_UNKNOWN_FAILURE_") + std::to_string(error);
 }
 
 
@@ -48,6 +62,17 @@ _Ret_z_ const char *XRTL_DETAIL_NAMESPACE::xr_error_category<TError>::name(
  * XRTL_NAMESPACE::xr_category_instance
  */
 inline void XRTL_NAMESPACE::xr_category_instance(_In_opt_ XrInstance instance) {
+    xr_category_instance(instance, nullptr);
+}
+
+
+/*
+ * XRTL_NAMESPACE::xr_category_instance
+ */
+inline void XRTL_NAMESPACE::xr_category_instance(_In_opt_ XrInstance instance,
+        _In_opt_ PFN_xrResultToString to_string) {
     typedef detail::xr_error_category<XrResult> category;
-    detail::xr_category<category>()._instance = instance;
+    auto& c = detail::xr_category<category>();
+    c._instance = instance;
+    c._to_string = (instance != XR_NULL_HANDLE) ? to_string : nullptr;
 }
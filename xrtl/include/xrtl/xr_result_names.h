@@ -0,0 +1,22 @@
+﻿// <copyright file="xr_result_names.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_XRTL_XR_RESULT_NAMES_H)
+#define _XRTL_XR_RESULT_NAMES_H
+#pragma once
+
+#include <openxr/openxr.h>
+
+#include "xrtl/api.h"
+
+
+XRTL_NAMESPACE_BEGIN
+
+#include "xrtl/xr_result_names.inl"
+
+XRTL_NAMESPACE_END
+
+#endif /* !defined(_XRTL_XR_RESULT_NAMES_H) */